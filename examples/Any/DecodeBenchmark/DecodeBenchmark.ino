@@ -0,0 +1,337 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*  Example:      DecodeBenchmark
+*  Description:  Time each control function, the bulk 'decode()', and
+*                'printDebug()' for every controller type. Every function
+*                is run on a few recorded frames and the result is reported
+*                in nanoseconds per call, with the standard deviation over
+*                all runs.
+*
+*                To check for regressions, run this once with
+*                'SaveReference' set to 'true'. That run is saved to the
+*                EEPROM as the reference. After that, runs with
+*                'SaveReference' set to 'false' compare against it. A
+*                function fails if it is more than 'RegressionThreshold'
+*                percent slower, beyond its measured noise.
+*
+*                This does not need a controller connected.
+*/
+
+#include <NintendoExtensionCtrl.h>
+#include <EEPROM.h>
+
+const boolean SaveReference = false;     // 'true' to save this run as the reference for later runs
+const uint8_t RegressionThreshold = 10;  // Percent slower than the reference that counts as a regression
+
+const uint8_t NumFrames = 2;       // Recorded frames per controller
+const uint8_t NumRuns = 8;         // Timed runs per frame, for the variance
+const uint8_t NumIterations = 50;  // Calls per timed run
+
+typedef void (*BenchFunction)();
+
+// Port that can be loaded with recorded control data
+class BenchmarkPort : public ExtensionPort {
+public:
+	typedef uint8_t Frame[6];
+
+	void load(const Frame& frame) {
+		for (uint8_t i = 0; i < sizeof(Frame); i++) {
+			setControlData(i, frame[i]);
+		}
+	}
+};
+
+// Print output that goes nowhere, for timing 'printDebug()'
+class NullPrint : public Print {
+public:
+	size_t write(uint8_t) { return 1; }
+};
+
+BenchmarkPort port;  // Shared data for all of the controller types below
+NullPrint nullOutput;
+
+Nunchuk::Shared nchuk(port);
+ClassicController::Shared classic(port);
+GuitarController::Shared guitar(port);
+DrumController::Shared drums(port);
+DJTurntableController::Shared dj(port);
+uDrawTablet::Shared udraw(port);
+DrawsomeTablet::Shared drawsome(port);
+
+// Recorded frames for each controller: idle, then with the controls in use
+const BenchmarkPort::Frame NunchukFrames[NumFrames] = {
+	{ 0x80, 0x7F, 0x82, 0x7E, 0xB3, 0x93 },
+	{ 0xE1, 0x1C, 0x9A, 0x6C, 0xC0, 0x5C },
+};
+
+const BenchmarkPort::Frame ClassicFrames[NumFrames] = {
+	{ 0x60, 0x20, 0x10, 0x00, 0xFF, 0xFF },
+	{ 0x7D, 0xA3, 0x8C, 0x4A, 0x5A, 0x2E },
+};
+
+const BenchmarkPort::Frame GuitarFrames[NumFrames] = {
+	{ 0xE0, 0xE0, 0xFF, 0xEF, 0xFF, 0xFF },
+	{ 0xE5, 0xDB, 0xEA, 0xF4, 0xBF, 0x8E },
+};
+
+const BenchmarkPort::Frame DrumFrames[NumFrames] = {
+	{ 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF },
+	{ 0xE3, 0xDE, 0x33, 0x5F, 0xFF, 0xAF },
+};
+
+const BenchmarkPort::Frame DJFrames[NumFrames] = {
+	{ 0xE0, 0xE0, 0x60, 0x10, 0xFF, 0xFF },
+	{ 0x5B, 0x2A, 0xA4, 0x36, 0xDC, 0xB6 },
+};
+
+const BenchmarkPort::Frame uDrawFrames[NumFrames] = {
+	{ 0xFF, 0xFF, 0xFF, 0x08, 0xFF, 0xFF },
+	{ 0x7A, 0x9C, 0x34, 0x9E, 0xFA, 0xFB },
+};
+
+const BenchmarkPort::Frame DrawsomeFrames[NumFrames] = {
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x3C, 0x7E, 0x12, 0x5B, 0x9A, 0x0F },
+};
+
+const BenchmarkPort::Frame * frames = NunchukFrames;  // Frames for the controller being tested
+
+void useFrames(const __FlashStringHelper* name, const BenchmarkPort::Frame* set) {
+	frames = set;
+
+	Serial.println();
+	Serial.println(name);
+}
+
+volatile uint16_t sink;  // Output for decoded data, so the compiler can't optimize it away
+
+float baseline = 0.0;  // Loop and call overhead, in ns per call
+
+// EEPROM layout for the reference: marker, number of results, then ns per call for each (32 bits)
+const uint16_t ReferenceMarker = 0x4E59;
+const int ReferenceCountAddress = sizeof(uint16_t);
+const int ReferenceStartAddress = ReferenceCountAddress + sizeof(uint16_t);
+
+uint16_t referenceCount = 0;  // Results in the saved reference, 0 if there is none
+uint16_t testIndex = 0;
+uint16_t regressions = 0;
+
+void measure(BenchFunction fn, float& mean, float& deviation) {
+	uint16_t n = 0;
+	float m2 = 0.0;
+	mean = 0.0;
+
+	for (uint8_t f = 0; f < NumFrames; f++) {
+		port.load(frames[f]);
+
+		for (uint8_t r = 0; r < NumRuns; r++) {
+			unsigned long start = micros();
+			for (uint8_t i = 0; i < NumIterations; i++) {
+				fn();
+			}
+			const float x = (float) (micros() - start) * 1000 / NumIterations - baseline;
+
+			n++;  // Welford's running variance
+			const float delta = x - mean;
+			mean += delta / n;
+			m2 += delta * (x - mean);
+		}
+	}
+
+	deviation = (n > 1) ? sqrt(m2 / (n - 1)) : 0.0;
+}
+
+void bench(const __FlashStringHelper* name, BenchFunction fn) {
+	float mean, deviation;
+	measure(fn, mean, deviation);
+
+	const uint32_t result = (mean < 0.0) ? 0 : (uint32_t) (mean + 0.5);  // 32 bits, 'printDebug()' takes longer than 65535 ns
+	const int address = ReferenceStartAddress + testIndex * sizeof(uint32_t);
+
+	Serial.print(F("  "));
+	Serial.print(name);
+	Serial.print(F(": "));
+	Serial.print(result);
+	Serial.print(F(" ns/op +/- "));
+	Serial.print(deviation, 0);
+
+	if (SaveReference) {
+		EEPROM.put(address, result);
+	}
+	else if (testIndex < referenceCount) {
+		uint32_t reference;
+		EEPROM.get(address, reference);
+
+		Serial.print(F(", ref "));
+		Serial.print(reference);
+
+		const float limit = (float) reference * (100 + RegressionThreshold) / 100 + deviation * 2;
+		if (result > limit) {
+			Serial.print(F(" - REGRESSION"));
+			regressions++;
+		}
+	}
+	Serial.println();
+
+	testIndex++;
+}
+
+#define BENCH(expr) bench(F(#expr), []() { sink = expr; })
+
+void setup() {
+	Serial.begin(115200);
+	while (!Serial);  // Wait for serial for output
+
+	Serial.println(F("Starting Decode Benchmark..."));
+
+	uint16_t marker;
+	EEPROM.get(0, marker);
+	if (!SaveReference && marker == ReferenceMarker) {
+		EEPROM.get(ReferenceCountAddress, referenceCount);
+	}
+
+	float deviation;
+	measure([]() {}, baseline, deviation);  // loop and call overhead
+
+	useFrames(F("Nunchuk"), NunchukFrames);
+	BENCH(nchuk.joyX());
+	BENCH(nchuk.joyY());
+	BENCH(nchuk.accelX());
+	BENCH(nchuk.accelY());
+	BENCH(nchuk.accelZ());
+	BENCH(nchuk.gForceX());
+	BENCH(nchuk.buttonC());
+	BENCH(nchuk.buttonZ());
+	BENCH(nchuk.buttons());
+	BENCH(nchuk.rollAngleCenti());
+	BENCH(nchuk.pitchAngleCenti());
+	BENCH(nchuk.rollAngle());
+	BENCH(nchuk.pitchAngle());
+	bench(F("nchuk.decode()"), []() { Nunchuk::State s; nchuk.decode(s); sink = s.buttons; });
+	bench(F("nchuk.printDebug()"), []() { nchuk.printDebug(nullOutput); });
+
+	useFrames(F("Classic Controller"), ClassicFrames);
+	BENCH(classic.leftJoyX());
+	BENCH(classic.leftJoyY());
+	BENCH(classic.rightJoyX());
+	BENCH(classic.rightJoyY());
+	BENCH(classic.triggerL());
+	BENCH(classic.triggerR());
+	BENCH(classic.dpadUp());
+	BENCH(classic.buttonA());
+	BENCH(classic.buttonZL());
+	BENCH(classic.buttonHome());
+	BENCH(classic.buttons());
+	bench(F("classic.decode()"), []() { ClassicController::State s; classic.decode(s); sink = s.buttons; });
+	bench(F("classic.printDebug()"), []() { classic.printDebug(nullOutput); });
+
+	useFrames(F("Guitar"), GuitarFrames);
+	BENCH(guitar.joyX());
+	BENCH(guitar.joyY());
+	BENCH(guitar.strum());
+	BENCH(guitar.strumUp());
+	BENCH(guitar.fretGreen());
+	BENCH(guitar.fretOrange());
+	BENCH(guitar.whammyBar());
+	BENCH(guitar.touchbar());
+	BENCH(guitar.touchFrets());
+	BENCH(guitar.touchGreen());
+	BENCH(guitar.buttonPlus());
+	BENCH(guitar.buttons());
+	bench(F("guitar.decode()"), []() { GuitarController::State s; guitar.decode(s); sink = s.buttons; });
+	bench(F("guitar.printDebug()"), []() { guitar.printDebug(nullOutput); });
+
+	useFrames(F("Drums"), DrumFrames);
+	BENCH(drums.joyX());
+	BENCH(drums.joyY());
+	BENCH(drums.drumRed());
+	BENCH(drums.cymbalYellow());
+	BENCH(drums.bassPedal());
+	BENCH(drums.buttonPlus());
+	BENCH(drums.buttons());
+	BENCH(drums.velocityAvailable());
+	BENCH(drums.velocityID());
+	BENCH(drums.velocity());
+	BENCH(drums.velocity(DrumController::VelocityID::Red));
+	BENCH(drums.velocityPedal());
+	bench(F("drums.decode()"), []() { DrumController::State s; drums.decode(s); sink = s.buttons; });
+	bench(F("drums.printDebug()"), []() { drums.printDebug(nullOutput); });
+
+	useFrames(F("DJ Turntable"), DJFrames);
+	BENCH(dj.joyX());
+	BENCH(dj.joyY());
+	BENCH(dj.turntable());
+	BENCH(dj.left.turntable());
+	BENCH(dj.right.turntable());
+	BENCH(dj.left.buttonGreen());
+	BENCH(dj.right.buttonBlue());
+	BENCH(dj.effectDial());
+	BENCH(dj.crossfadeSlider());
+	BENCH(dj.buttonEuphoria());
+	BENCH(dj.buttons());
+	bench(F("dj.decode()"), []() { DJTurntableController::State s; dj.decode(s); sink = s.buttons; });
+	bench(F("dj.printDebug()"), []() { dj.printDebug(nullOutput); });
+
+	useFrames(F("uDraw Tablet"), uDrawFrames);
+	BENCH(udraw.penX());
+	BENCH(udraw.penY());
+	BENCH(udraw.penPressure());
+	BENCH(udraw.penDetected());
+	BENCH(udraw.buttonLower());
+	BENCH(udraw.buttons());
+	bench(F("udraw.decode()"), []() { uDrawTablet::State s; udraw.decode(s); sink = s.buttons; });
+	bench(F("udraw.printDebug()"), []() { udraw.printDebug(nullOutput); });
+
+	useFrames(F("Drawsome Tablet"), DrawsomeFrames);
+	BENCH(drawsome.penX());
+	BENCH(drawsome.penY());
+	BENCH(drawsome.penPressure());
+	BENCH(drawsome.penDetected());
+	bench(F("drawsome.decode()"), []() { DrawsomeTablet::State s; drawsome.decode(s); sink = s.penX; });
+	bench(F("drawsome.printDebug()"), []() { drawsome.printDebug(nullOutput); });
+
+	Serial.println();
+
+	if (SaveReference) {
+		EEPROM.put(0, ReferenceMarker);
+		EEPROM.put(ReferenceCountAddress, testIndex);
+		Serial.print(F("Saved "));
+		Serial.print(testIndex);
+		Serial.println(F(" results as the reference"));
+	}
+	else if (referenceCount == 0) {
+		Serial.println(F("No reference saved, nothing to compare against"));
+	}
+	else {
+		Serial.print(regressions);
+		Serial.print(F(" of "));
+		Serial.print(testIndex);
+		Serial.print(F(" functions regressed by more than "));
+		Serial.print(RegressionThreshold);
+		Serial.println(F("%"));
+		Serial.println(regressions == 0 ? F("PASS") : F("FAIL"));
+	}
+}
+
+void loop() {
+	// Nothing to do here
+}
@@ -0,0 +1,131 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2018 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*  Example:      DecodeSpeed
+*  Description:  Measure the time it takes to decode one frame of control
+*                data for every controller type, using both the bulk
+*                'decode()' function and the individual control functions.
+*
+*                Decoding time does not depend on the controller, so this
+*                runs on whatever data is in the buffer and does not need
+*                a controller connected.
+*/
+
+#include <NintendoExtensionCtrl.h>
+
+ExtensionPort port;  // Shared data for all of the controller types below
+
+Nunchuk::Shared nchuk(port);
+ClassicController::Shared classic(port);
+GuitarController::Shared guitar(port);
+DrumController::Shared drums(port);
+DJTurntableController::Shared dj(port);
+uDrawTablet::Shared udraw(port);
+DrawsomeTablet::Shared drawsome(port);
+
+const unsigned int NumFrames = 1000;  // Number of frames to decode for each test
+
+volatile uint16_t sink;  // Output for decoded data, so the compiler can't optimize it away
+
+unsigned long timeFrames(void (*decode)()) {
+	unsigned long start = micros();
+	for (unsigned int i = 0; i < NumFrames; i++) {
+		decode();
+	}
+	return micros() - start;
+}
+
+void runTest(const char* name, void (*bulk)(), void (*accessors)()) {
+	const unsigned long baseline = timeFrames([]() {});  // loop and call overhead
+
+	unsigned long bulkTime = timeFrames(bulk);
+	unsigned long accessorTime = timeFrames(accessors);
+
+	bulkTime = (bulkTime > baseline) ? bulkTime - baseline : 0;
+	accessorTime = (accessorTime > baseline) ? accessorTime - baseline : 0;
+
+	Serial.print(name);
+	Serial.print(" - Bulk: ");
+	Serial.print(bulkTime * 1000 / NumFrames);  // microseconds to nanoseconds per frame
+	Serial.print(" ns/frame, Accessors: ");
+	Serial.print(accessorTime * 1000 / NumFrames);
+	Serial.println(" ns/frame");
+}
+
+void setup() {
+	Serial.begin(115200);
+	while (!Serial);  // Wait for serial for output
+
+	Serial.println("Starting Decode Speed Test...");
+
+	runTest("Nunchuk",
+		[]() { Nunchuk::State s; nchuk.decode(s); sink = s.joyX ^ s.joyY ^ s.accelX ^ s.accelY ^ s.accelZ ^ s.buttons; },
+		[]() { sink = nchuk.joyX() ^ nchuk.joyY() ^ nchuk.accelX() ^ nchuk.accelY() ^ nchuk.accelZ()
+			^ nchuk.buttonC() ^ nchuk.buttonZ(); });
+
+	runTest("Classic Controller",
+		[]() { ClassicController::State s; classic.decode(s);
+			sink = s.leftJoyX ^ s.leftJoyY ^ s.rightJoyX ^ s.rightJoyY ^ s.triggerL ^ s.triggerR ^ s.buttons; },
+		[]() { sink = classic.leftJoyX() ^ classic.leftJoyY() ^ classic.rightJoyX() ^ classic.rightJoyY()
+			^ classic.triggerL() ^ classic.triggerR()
+			^ classic.dpadUp() ^ classic.dpadDown() ^ classic.dpadLeft() ^ classic.dpadRight()
+			^ classic.buttonA() ^ classic.buttonB() ^ classic.buttonX() ^ classic.buttonY()
+			^ classic.buttonL() ^ classic.buttonR() ^ classic.buttonZL() ^ classic.buttonZR()
+			^ classic.buttonPlus() ^ classic.buttonMinus() ^ classic.buttonHome(); });
+
+	runTest("Guitar",
+		[]() { GuitarController::State s; guitar.decode(s); sink = s.joyX ^ s.joyY ^ s.whammyBar ^ s.touchbar ^ s.buttons; },
+		[]() { sink = guitar.joyX() ^ guitar.joyY() ^ guitar.whammyBar() ^ guitar.touchbar()
+			^ guitar.strumUp() ^ guitar.strumDown()
+			^ guitar.fretGreen() ^ guitar.fretRed() ^ guitar.fretYellow() ^ guitar.fretBlue() ^ guitar.fretOrange()
+			^ guitar.buttonPlus() ^ guitar.buttonMinus(); });
+
+	runTest("Drums",
+		[]() { DrumController::State s; drums.decode(s); sink = s.joyX ^ s.joyY ^ s.velocityID ^ s.velocity ^ s.buttons; },
+		[]() { sink = drums.joyX() ^ drums.joyY() ^ drums.velocityID() ^ drums.velocity()
+			^ drums.drumRed() ^ drums.drumBlue() ^ drums.drumGreen()
+			^ drums.cymbalYellow() ^ drums.cymbalOrange() ^ drums.bassPedal()
+			^ drums.buttonPlus() ^ drums.buttonMinus(); });
+
+	runTest("DJ Turntable",
+		[]() { DJTurntableController::State s; dj.decode(s);
+			sink = s.joyX ^ s.joyY ^ s.leftTurntable ^ s.rightTurntable ^ s.effectDial ^ s.crossfadeSlider ^ s.buttons; },
+		[]() { sink = dj.joyX() ^ dj.joyY() ^ dj.left.turntable() ^ dj.right.turntable()
+			^ dj.effectDial() ^ dj.crossfadeSlider()
+			^ dj.left.buttonGreen() ^ dj.left.buttonRed() ^ dj.left.buttonBlue()
+			^ dj.right.buttonGreen() ^ dj.right.buttonRed() ^ dj.right.buttonBlue()
+			^ dj.buttonEuphoria() ^ dj.buttonPlus() ^ dj.buttonMinus(); });
+
+	runTest("uDraw Tablet",
+		[]() { uDrawTablet::State s; udraw.decode(s); sink = s.penX ^ s.penY ^ s.penPressure ^ s.penDetected ^ s.buttons; },
+		[]() { sink = udraw.penX() ^ udraw.penY() ^ udraw.penPressure() ^ udraw.penDetected()
+			^ udraw.buttonLower() ^ udraw.buttonUpper(); });
+
+	runTest("Drawsome Tablet",
+		[]() { DrawsomeTablet::State s; drawsome.decode(s); sink = s.penX ^ s.penY ^ s.penPressure ^ s.penDetected; },
+		[]() { sink = drawsome.penX() ^ drawsome.penY() ^ drawsome.penPressure() ^ drawsome.penDetected(); });
+
+	Serial.println("Done!");
+}
+
+void loop() {
+	// Nothing to do here
+}
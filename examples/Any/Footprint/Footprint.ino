@@ -0,0 +1,84 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*  Example:      Footprint
+*  Description:  Minimal program for measuring the flash and RAM used by one
+*                controller class. It connects and updates, and nothing else.
+*                The class is picked at compile time, so each build measures
+*                only one:
+*
+*                  -DFOOTPRINT_CLASS=ClassicController  (any controller class)
+*                  -DFOOTPRINT_PORT_VARIANTS=3  (ExtensionPort, 1-7 variants)
+*                  -DFOOTPRINT_NONE  (baseline, no controller)
+*
+*                With no options it builds for the Nunchuk. The CI build runs
+*                this for every class and saves the section and symbol sizes
+*                as a report, which can be compared between commits.
+*/
+
+#include <NintendoExtensionCtrl.h>
+
+#if !defined(FOOTPRINT_CLASS) && !defined(FOOTPRINT_PORT_VARIANTS) && !defined(FOOTPRINT_NONE)
+#define FOOTPRINT_CLASS Nunchuk
+#endif
+
+#if defined(FOOTPRINT_CLASS)
+FOOTPRINT_CLASS controller;
+
+#elif defined(FOOTPRINT_PORT_VARIANTS)
+ExtensionPort controller;
+
+Nunchuk::Shared nchuk(controller);
+#if FOOTPRINT_PORT_VARIANTS >= 2
+ClassicController::Shared classic(controller);
+#endif
+#if FOOTPRINT_PORT_VARIANTS >= 3
+GuitarController::Shared guitar(controller);
+#endif
+#if FOOTPRINT_PORT_VARIANTS >= 4
+DrumController::Shared drums(controller);
+#endif
+#if FOOTPRINT_PORT_VARIANTS >= 5
+DJTurntableController::Shared dj(controller);
+#endif
+#if FOOTPRINT_PORT_VARIANTS >= 6
+uDrawTablet::Shared udraw(controller);
+#endif
+#if FOOTPRINT_PORT_VARIANTS >= 7
+DrawsomeTablet::Shared drawsome(controller);
+#endif
+#endif
+
+volatile uint8_t sink;  // Output for the data, so the compiler can't optimize it away
+
+void setup() {
+#ifndef FOOTPRINT_NONE
+	controller.begin();
+	controller.connect();
+#endif
+}
+
+void loop() {
+#ifndef FOOTPRINT_NONE
+	controller.update();
+	sink = controller.getControlData(0);
+#endif
+}
@@ -0,0 +1,113 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*  Example:      MIDISpeed
+*  Description:  Measure the MIDI encoder, by replaying a short guitar
+*                session through it and reporting the time and the number
+*                of MIDI bytes for each frame. The session is replayed with
+*                and without running status for comparison.
+*
+*                This does not need a controller connected.
+*/
+
+#include <NintendoExtensionCtrl.h>
+
+MIDIEncoder midi(MIDIEncoder::GuitarMap);
+
+// Recorded frames: buttons, and the whammy, touchbar, joystick X / Y as MIDI values
+struct Frame {
+	uint16_t buttons;
+	uint8_t controls[4];
+};
+
+const Frame Session[] = {
+	{ 0x000, { 60,  0, 64, 64 } },
+	{ 0x004, { 60,  0, 64, 64 } },  // green
+	{ 0x005, { 60,  0, 64, 64 } },  // strum
+	{ 0x004, { 60,  0, 64, 64 } },
+	{ 0x00C, { 60,  0, 64, 64 } },  // green + red
+	{ 0x00E, { 60,  0, 64, 64 } },  // strum
+	{ 0x00C, { 64,  0, 64, 64 } },  // whammy
+	{ 0x00C, { 72,  0, 64, 64 } },
+	{ 0x00C, { 84,  0, 64, 64 } },
+	{ 0x00C, { 72,  0, 64, 64 } },
+	{ 0x000, { 60,  0, 64, 64 } },
+	{ 0x070, { 60,  0, 64, 64 } },  // chord
+	{ 0x071, { 60,  0, 64, 64 } },  // strum
+	{ 0x070, { 60, 40, 64, 64 } },  // touchbar
+	{ 0x070, { 60, 56, 64, 64 } },
+	{ 0x000, { 60,  0, 66, 60 } },  // joystick
+};
+
+const uint8_t NumFrames = sizeof(Session) / sizeof(Session[0]);
+const unsigned int NumReplays = 200;
+
+uint8_t midiBuffer[48];
+
+void runTest(const char* name, boolean runningStatus) {
+	unsigned long bytes = 0;
+	uint8_t maxBytes = 0;
+
+	midi.reset();
+	midi.setBuffer(midiBuffer, sizeof(midiBuffer));
+
+	unsigned long start = micros();
+	for (unsigned int r = 0; r < NumReplays; r++) {
+		for (uint8_t i = 0; i < NumFrames; i++) {
+			if (!runningStatus) midi.resetRunningStatus();  // status byte on every message
+
+			midi.encodeButtons(Session[i].buttons);
+			midi.encodeControls(Session[i].controls);
+
+			bytes += midi.length();
+			if (midi.length() > maxBytes) maxBytes = midi.length();
+			midi.clear();
+		}
+	}
+	unsigned long time = micros() - start;
+
+	const unsigned long frames = (unsigned long) NumReplays * NumFrames;
+
+	Serial.print(name);
+	Serial.print(" - ");
+	Serial.print(time * 1000 / frames);  // microseconds to nanoseconds per frame
+	Serial.print(" ns/frame, ");
+	Serial.print((float) bytes / frames);
+	Serial.print(" bytes/frame avg, ");
+	Serial.print(maxBytes);
+	Serial.println(" max");
+}
+
+void setup() {
+	Serial.begin(115200);
+	while (!Serial);  // Wait for serial for output
+
+	Serial.println("Starting MIDI Speed Test...");
+
+	runTest("Running status", true);
+	runTest("No running status", false);
+
+	Serial.println("Done!");
+}
+
+void loop() {
+	// Nothing to do here
+}
@@ -0,0 +1,76 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2018 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*  Example:      Multiplexer
+*  Description:  Communicate with two extension controllers on the same
+*                I2C bus, using a TCA9548A I2C multiplexer. The controllers
+*                are connected to channels 0 and 1 of the multiplexer.
+*
+*                This example uses Nunchuks, but this process works the same
+*                with any controller in the library.
+*/
+
+#include <NintendoExtensionCtrl.h>
+
+I2CMultiplexer mux(Wire, 0x70);  // Multiplexer on the default bus, at address 0x70
+
+Nunchuk nchuk1(mux, 0);  // Controller on mux channel 0
+Nunchuk nchuk2(mux, 1);  // Controller on mux channel 1
+
+void setup() {
+	Serial.begin(115200);
+	nchuk1.begin();  // init I2C
+
+	while (!nchuk1.connect()) {
+		Serial.println("Nunchuk on channel #0 not detected!");
+		delay(1000);
+	}
+
+	while (!nchuk2.connect()) {
+		Serial.println("Nunchuk on channel #1 not detected!");
+		delay(1000);
+	}
+}
+
+void loop() {
+	// The multiplexer channel is switched automatically for each controller
+	Serial.print("Channel #0: ");
+	boolean success = nchuk1.update();
+	if (success == true) {
+		nchuk1.printDebug();
+	}
+	else {
+		Serial.println("Disconnected!");
+		nchuk1.connect();
+	}
+
+	Serial.print("Channel #1: ");
+	success = nchuk2.update();
+	if (success == true) {
+		nchuk2.printDebug();
+	}
+	else {
+		Serial.println("Disconnected!");
+		nchuk2.connect();
+	}
+
+	delay(100);
+}
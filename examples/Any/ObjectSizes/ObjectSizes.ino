@@ -0,0 +1,75 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*  Example:      ObjectSizes
+*  Description:  Print the RAM used by one object of each controller class,
+*                including its control data buffer. Each controller's buffer
+*                is sized for the largest request it makes, so the sizes
+*                here depend on the controller type as well as the board.
+*
+*                This does not need a controller connected.
+*/
+
+#include <NintendoExtensionCtrl.h>
+
+#define PRINT_SIZE(...) printSize(#__VA_ARGS__, sizeof(__VA_ARGS__))  // variadic, for template commas
+
+void printSize(const char* name, size_t size) {
+	Serial.print(name);
+	Serial.print(": ");
+	Serial.print(size);
+	Serial.println(" bytes");
+}
+
+void setup() {
+	Serial.begin(115200);
+	while (!Serial);  // Wait for serial for output
+
+	Serial.println("Controller Classes");
+	PRINT_SIZE(Nunchuk);
+	PRINT_SIZE(ClassicController);
+	PRINT_SIZE(NESMiniController);
+	PRINT_SIZE(SNESMiniController);
+	PRINT_SIZE(GuitarController);
+	PRINT_SIZE(DrumController);
+	PRINT_SIZE(DJTurntableController);
+	PRINT_SIZE(uDrawTablet);
+	PRINT_SIZE(DrawsomeTablet);
+	Serial.println();
+
+	Serial.println("Ports and Shared Variants");
+	PRINT_SIZE(ExtensionPort);
+	PRINT_SIZE(Nunchuk::Shared);
+	PRINT_SIZE(ClassicController::Shared);
+	PRINT_SIZE(ExtensionPortOf<Nunchuk>);
+	PRINT_SIZE(ExtensionPortOf<Nunchuk, ClassicController>);
+	Serial.println();
+
+	Serial.println("Control Data");
+	PRINT_SIZE(NintendoExtensionCtrl::ExtensionController::ExtensionData);
+	PRINT_SIZE(NintendoExtensionCtrl::ExtensionController::ExtensionDataOf<Nunchuk::MaxRequestSize>);
+	PRINT_SIZE(NintendoExtensionCtrl::ExtensionController::ExtensionDataOf<ClassicController::MaxRequestSize>);
+	PRINT_SIZE(NintendoExtensionCtrl::ExtensionController::ExtensionDataOf<ExtensionPort::MaxRequestSize>);
+}
+
+void loop() {
+	// Nothing to do here
+}
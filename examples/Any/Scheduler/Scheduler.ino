@@ -0,0 +1,80 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2018 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*  Example:      Scheduler
+*  Description:  Poll two controllers on separate I2C buses at different
+*                rates, and print the achieved rate and number of missed
+*                deadlines for each once per second. Requires a
+*                microcontroller with two I2C buses (e.g. Arduino Due or Teensy).
+*/
+
+#include <NintendoExtensionCtrl.h>
+
+DrumController drums(Wire);   // Drums need fast polling to catch velocity data
+Nunchuk nchuk(Wire1);         // Nunchuk can be polled more slowly
+
+ExtensionScheduler<2> scheduler;  // Scheduler with room for two ports
+
+unsigned long lastPrint = 0;
+
+void setup() {
+	Serial.begin(115200);
+	drums.begin();
+	nchuk.begin();
+
+	while (!drums.connect()) {
+		Serial.println("Drum controller not detected!");
+		delay(1000);
+	}
+
+	while (!nchuk.connect()) {
+		Serial.println("Nunchuk not detected!");
+		delay(1000);
+	}
+
+	scheduler.add(drums, 1000, 1);  // Port 0: 1 kHz, higher priority
+	scheduler.add(nchuk, 100);      // Port 1: 100 Hz, default priority
+}
+
+void loop() {
+	int8_t updated = scheduler.run();  // Update whichever port is due
+
+	if (updated == 0 && drums.velocityAvailable()) {
+		Serial.print("Drum hit! Velocity: ");
+		Serial.println(drums.velocity());
+	}
+
+	if (millis() - lastPrint >= 1000) {
+		lastPrint = millis();
+
+		for (uint8_t i = 0; i < scheduler.size(); i++) {
+			Serial.print("Port ");
+			Serial.print(i);
+			Serial.print(": ");
+			Serial.print(scheduler.getRate(i));
+			Serial.print(" Hz, ");
+			Serial.print(scheduler.getMisses(i));
+			Serial.print(" missed");
+			if (!scheduler.updateSuccess(i)) Serial.print(" (disconnected?)");
+			Serial.println();
+		}
+	}
+}
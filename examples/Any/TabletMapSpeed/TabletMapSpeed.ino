@@ -0,0 +1,141 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*  Example:      TabletMapSpeed
+*  Description:  Measure the time it takes to map a tablet pen sample to
+*                screen coordinates, using the fixed point mapping from
+*                'TabletCalibration' and the same mapping in floating point.
+*                Also reports the largest difference between the two.
+*
+*                This does not need a controller connected.
+*/
+
+#include <NintendoExtensionCtrl.h>
+
+TabletCalibration screen(DrawsomeTablet::PenMax);
+
+// A slightly rotated screen, as if tapped by hand
+const TabletCalibration::Point Corners[4] = {
+	{  6200,  5100,   0,   0 },
+	{ 59800,  6900, 799,   0 },
+	{ 58100, 60300, 799, 479 },
+	{  4700, 58900,   0, 479 },
+};
+
+float coefX[3], coefY[3];  // Floating point version of the same fit
+
+const unsigned int NumSamples = 1000;
+
+volatile int16_t sink;  // Output for mapped data, so the compiler can't optimize it away
+
+uint16_t samplePen(unsigned int i) {
+	return (uint16_t) (i * 65521UL);  // Spread across the tablet
+}
+
+void fitFloat() {
+	// Solve the float fit exactly from three corners, to compare against
+	for (uint8_t axis = 0; axis < 2; axis++) {
+		float* coef = axis ? coefY : coefX;
+		const float s0 = axis ? Corners[0].screenY : Corners[0].screenX;
+		const float s1 = axis ? Corners[1].screenY : Corners[1].screenX;
+		const float s3 = axis ? Corners[3].screenY : Corners[3].screenX;
+
+		const float ux = Corners[1].penX - (float) Corners[0].penX, uy = Corners[1].penY - (float) Corners[0].penY;
+		const float vx = Corners[3].penX - (float) Corners[0].penX, vy = Corners[3].penY - (float) Corners[0].penY;
+		const float det = ux * vy - uy * vx;
+
+		coef[0] = ((s1 - s0) * vy - (s3 - s0) * uy) / det;
+		coef[1] = ((s3 - s0) * ux - (s1 - s0) * vx) / det;
+		coef[2] = s0 - coef[0] * Corners[0].penX - coef[1] * Corners[0].penY;
+	}
+}
+
+void setup() {
+	Serial.begin(115200);
+	while (!Serial);  // Wait for serial for output
+
+	Serial.println("Starting Tablet Mapping Speed Test...");
+
+	TabletCalibration::Point fitPoints[3] = { Corners[0], Corners[1], Corners[3] };
+	screen.calibrate(fitPoints, 3);
+	screen.setScreenSize(800, 480);
+	fitFloat();
+
+	unsigned long start = micros();
+	for (unsigned int i = 0; i < NumSamples; i++) {
+		int16_t x, y;
+		screen.map(samplePen(i), samplePen(i + 7), x, y);
+		sink = x ^ y;
+	}
+	const unsigned long fixedTime = micros() - start;
+
+	start = micros();
+	for (unsigned int i = 0; i < NumSamples; i++) {
+		const uint16_t penX = samplePen(i), penY = samplePen(i + 7);
+		const float x = coefX[0] * penX + coefX[1] * penY + coefX[2];
+		const float y = coefY[0] * penX + coefY[1] * penY + coefY[2];
+		sink = (int16_t) constrain(x + 0.5f, 0, 799) ^ (int16_t) constrain(y + 0.5f, 0, 479);
+	}
+	const unsigned long floatTime = micros() - start;
+
+	int16_t worst = 0;
+	for (unsigned int i = 0; i < NumSamples; i++) {
+		const uint16_t penX = samplePen(i), penY = samplePen(i + 7);
+		int16_t x, y;
+		screen.map(penX, penY, x, y);
+
+		const int16_t fx = constrain(coefX[0] * penX + coefX[1] * penY + coefX[2] + 0.5f, 0, 799);
+		const int16_t fy = constrain(coefY[0] * penX + coefY[1] * penY + coefY[2] + 0.5f, 0, 479);
+		worst = max(worst, (int16_t) max(abs(x - fx), abs(y - fy)));
+	}
+
+	Serial.print("Fixed point (");
+	Serial.print(screen.getShift());
+	Serial.print(" bits) - ");
+	Serial.print(fixedTime * 1000 / NumSamples);  // microseconds to nanoseconds per sample
+	Serial.print(" ns/sample");
+#ifdef F_CPU
+	Serial.print(", ~");
+	Serial.print(fixedTime * (F_CPU / 1000000UL) / NumSamples);
+	Serial.print(" cycles");
+#endif
+	Serial.println();
+
+	Serial.print("Floating point - ");
+	Serial.print(floatTime * 1000 / NumSamples);
+	Serial.print(" ns/sample");
+#ifdef F_CPU
+	Serial.print(", ~");
+	Serial.print(floatTime * (F_CPU / 1000000UL) / NumSamples);
+	Serial.print(" cycles");
+#endif
+	Serial.println();
+
+	Serial.print("Largest difference: ");
+	Serial.print(worst);
+	Serial.println(" px");
+
+	Serial.println("Done!");
+}
+
+void loop() {
+	// Nothing to do here
+}
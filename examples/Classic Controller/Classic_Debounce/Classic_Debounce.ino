@@ -0,0 +1,81 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*  Example:      Classic_Debounce
+*  Description:  Connect to a Classic Controller and print each button press
+*                and release, debounced so that worn buttons don't trigger
+*                twice. All of the buttons are debounced together.
+*/
+
+#include <NintendoExtensionCtrl.h>
+
+ClassicController classic;
+ButtonDebouncer debouncer(3);  // A change must be seen for 3 updates in a row
+
+const char* const ButtonNames[15] = {  // Same order as the 'Buttons' bits
+	"Up", "Down", "Left", "Right",
+	"A", "B", "X", "Y",
+	"L", "R", "ZL", "ZR",
+	"Plus", "Minus", "Home",
+};
+
+void setup() {
+	Serial.begin(115200);
+	classic.begin();
+
+	while (!classic.connect()) {
+		Serial.println("Classic Controller not detected!");
+		delay(1000);
+	}
+
+	Serial.println("Ready! Press some buttons");
+}
+
+void loop() {
+	boolean success = classic.update();  // Get new data from the controller
+
+	if (!success) {
+		Serial.println("Controller disconnected!");
+		delay(1000);
+		classic.connect();
+		debouncer.reset();
+		return;
+	}
+
+	debouncer.update(classic.buttons());
+
+	const uint16_t pressed = debouncer.pressed();
+	const uint16_t released = debouncer.released();
+
+	if (pressed == 0 && released == 0) return;  // nothing new
+
+	for (uint8_t i = 0; i < 15; i++) {
+		const uint16_t mask = 1 << i;
+		if (pressed & mask) {
+			Serial.print(ButtonNames[i]);
+			Serial.println(" pressed");
+		}
+		else if (released & mask) {
+			Serial.print(ButtonNames[i]);
+			Serial.println(" released");
+		}
+	}
+}
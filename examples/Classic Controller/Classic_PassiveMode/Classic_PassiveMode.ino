@@ -0,0 +1,66 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*  Example:      Classic_PassiveMode
+*  Description:  Connect to a Classic Controller without waiting to verify
+*                its data mode. The mode is worked out from the regular
+*                updates instead, and the sketch prints whenever it changes.
+*/
+
+#include <NintendoExtensionCtrl.h>
+
+ClassicController classic;
+
+boolean lastMode = false;
+
+void setup() {
+	Serial.begin(115200);
+	classic.begin();
+	classic.setPassiveDetection();  // Must be set before connecting
+
+	while (!classic.connect()) {
+		Serial.println("Classic Controller not detected!");
+		delay(1000);
+	}
+
+	lastMode = classic.getHighRes();
+}
+
+void loop() {
+	boolean success = classic.update();  // Get new data, and check the data mode
+
+	if (success == true) {
+		boolean mode = classic.getHighRes();
+
+		if (mode != lastMode) {
+			Serial.print("Data mode changed to ");
+			Serial.println(mode ? "high resolution" : "standard");
+			lastMode = mode;
+		}
+
+		classic.printDebug();
+	}
+	else {
+		Serial.println("Controller Disconnected!");
+		delay(1000);
+		classic.connect();
+	}
+}
@@ -0,0 +1,74 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*  Example:      DJ_Platter
+*  Description:  Connect to a DJ Hero turntable and track the position
+*                and speed of the left platter. Warns if the platter is
+*                spinning too fast for the update rate to keep up with.
+*/
+
+#include <NintendoExtensionCtrl.h>
+
+DJTurntableController dj;
+DJTurntableController::TurntableTracker platter(dj.left);  // Track the left turntable
+
+unsigned long lastPrint = 0;
+
+void setup() {
+	Serial.begin(115200);
+	dj.begin();
+
+	while (!dj.connect()) {
+		Serial.println("DJ controller not detected!");
+		delay(1000);
+	}
+
+	Serial.println("Starting! Spin the left platter");
+}
+
+void loop() {
+	boolean success = dj.update();  // Get new data from the controller
+
+	if (!success) {
+		Serial.println("Controller disconnected!");
+		delay(1000);
+		dj.connect();
+		platter.reset();
+		return;
+	}
+
+	platter.update();  // Add up the platter movement, every update
+
+	if (platter.tooSlow()) {
+		Serial.println("Warning: platter is too fast for the update rate!");
+	}
+
+	// Print a few times per second, but keep updating as fast as possible
+	if (millis() - lastPrint >= 250) {
+		lastPrint = millis();
+
+		char buffer[64];
+		snprintf(buffer, sizeof(buffer),
+			"Revs: %4ld | Angle: %3u | Speed: %5d ticks/s",
+			(long) platter.revolutions(), platter.angle(), platter.velocity());
+		Serial.println(buffer);
+	}
+}
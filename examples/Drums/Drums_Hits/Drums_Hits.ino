@@ -0,0 +1,82 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*  Example:      Drums_Hits
+*  Description:  Connect to a Guitar Hero drum controller and print each
+*                drum hit along with its velocity, even during fast rolls
+*                where the velocity data arrives after the hit.
+*/
+
+#include <NintendoExtensionCtrl.h>
+
+DrumController drums;
+DrumController::HitDecoder hits(drums);  // Pass the object to the hit decoder
+
+const char* padName(DrumController::VelocityID pad) {
+	switch (pad) {
+	case DrumController::VelocityID::Red:    return "Red drum";
+	case DrumController::VelocityID::Blue:   return "Blue drum";
+	case DrumController::VelocityID::Green:  return "Green drum";
+	case DrumController::VelocityID::Yellow: return "Yellow cymbal";
+	case DrumController::VelocityID::Orange: return "Orange cymbal";
+	case DrumController::VelocityID::Pedal:  return "Bass pedal";
+	default: return "Unknown";
+	}
+}
+
+void setup() {
+	Serial.begin(115200);
+	drums.begin();
+
+	while (!drums.connect()) {
+		Serial.println("Drum controller not detected!");
+		delay(1000);
+	}
+
+	Serial.println("Ready! Hit some drums");
+}
+
+void loop() {
+	boolean success = drums.update();  // Get new data from the controller
+
+	if (!success) {
+		Serial.println("Controller disconnected!");
+		delay(1000);
+		drums.connect();
+		hits.reset();
+		return;
+	}
+
+	hits.update();  // Check the new data for hits
+
+	if (hits.tooSlow()) {
+		Serial.println("Warning: missed a velocity, update faster!");
+	}
+
+	DrumController::HitDecoder::Hit hit;
+	while (hits.read(hit)) {
+		Serial.print(hit.time);
+		Serial.print(" ms: ");
+		Serial.print(padName(hit.pad));
+		Serial.print(", velocity ");
+		Serial.println(hit.velocity);
+	}
+}
@@ -0,0 +1,70 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*  Example:      Guitar_Calibration
+*  Description:  Connect to a Guitar Hero controller and print its joystick
+*                and whammy bar as calibrated, centered values from -32767
+*                to 32767. Move the joystick through its full range so the
+*                calibration can learn its limits.
+*/
+
+#include <NintendoExtensionCtrl.h>
+
+GuitarController guitar;
+
+StickCalibration<6> joystick;  // 6-bit joystick, learns its range as it's used
+AxisCalibration<5> whammy;     // 5-bit whammy bar
+
+void setup() {
+	Serial.begin(115200);
+	guitar.begin();
+
+	while (!guitar.connect()) {
+		Serial.println("Guitar controller not detected!");
+		delay(1000);
+	}
+
+	joystick.axisX().setDeadzone(1);    // Ignore one count of jitter either side of center
+	joystick.axisY().setDeadzone(1);
+	joystick.setRadialDeadzone(3000);  // ...and anything close to the center overall
+
+	whammy.setRange(15, 15, 26);  // The whammy bar rests at ~15, so it's one-sided
+}
+
+void loop() {
+	boolean success = guitar.update();  // Get new data from the controller
+
+	if (!success) {
+		Serial.println("Controller disconnected!");
+		delay(1000);
+		guitar.connect();
+		return;
+	}
+
+	joystick.update(guitar.joyX(), guitar.joyY());
+
+	char buffer[64];
+	snprintf(buffer, sizeof(buffer),
+		"Joy:(%6d, %6d) | Whammy: %6d | Range X:(%2u, %2u, %2u)",
+		joystick.getX(), joystick.getY(), whammy.update(guitar.whammyBar()),
+		joystick.axisX().getMin(), joystick.axisX().getCenter(), joystick.axisX().getMax());
+	Serial.println(buffer);
+}
@@ -0,0 +1,65 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*  Example:      Guitar_MIDI
+*  Description:  Connect to a Guitar Hero controller and send it as a MIDI
+*                instrument over the serial port. The frets play notes and
+*                the whammy bar, touchbar, and joystick send control changes.
+*
+*                The serial port runs at the MIDI baud rate (31250), so this
+*                needs a MIDI output circuit or a serial to MIDI bridge on
+*                the computer side.
+*/
+
+#include <NintendoExtensionCtrl.h>
+
+GuitarController guitar;
+MIDIEncoder midi(MIDIEncoder::GuitarMap, 0);  // MIDI channel 1
+
+uint8_t midiBuffer[32];  // Output for one update
+
+void setup() {
+	Serial.begin(31250);  // MIDI baud rate
+	guitar.begin();
+
+	while (!guitar.connect()) {
+		delay(1000);  // Controller not detected, no way to report it over MIDI
+	}
+
+	midi.setBuffer(midiBuffer, sizeof(midiBuffer));
+}
+
+void loop() {
+	boolean success = guitar.update();  // Get new data from the controller
+
+	if (!success) {
+		delay(1000);
+		guitar.connect();
+		return;
+	}
+
+	midi.encode(guitar);  // Only writes what changed since the last update
+
+	if (midi.length() > 0) {
+		Serial.write(midiBuffer, midi.length());
+		midi.clear();
+	}
+}
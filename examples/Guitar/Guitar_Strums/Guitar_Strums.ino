@@ -0,0 +1,82 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*  Example:      Guitar_Strums
+*  Description:  Connect to a Guitar Hero controller and print each strum
+*                along with the frets held for it, ignoring any bounce from
+*                the strum bar switches.
+*/
+
+#include <NintendoExtensionCtrl.h>
+
+GuitarController guitar;
+GuitarController::StrumDecoder strums(guitar);  // Pass the object to the strum decoder
+
+void setup() {
+	Serial.begin(115200);
+	guitar.begin();
+
+	while (!guitar.connect()) {
+		Serial.println("Guitar controller not detected!");
+		delay(1000);
+	}
+
+	strums.setDebounce(20);  // ms, raise this if one strum shows up twice
+
+	Serial.println("Ready! Strum away");
+}
+
+void loop() {
+	boolean success = guitar.update();  // Get new data from the controller
+
+	if (!success) {
+		Serial.println("Controller disconnected!");
+		delay(1000);
+		guitar.connect();
+		strums.reset();
+		return;
+	}
+
+	strums.update();  // Check the new data for strums
+
+	GuitarController::StrumDecoder::Strum strum;
+	while (strums.read(strum)) {
+		const char fillCharacter = '_';
+		char chordPrint[6] = {
+			(strum.chord & GuitarController::Frets::Green)  ? 'G' : fillCharacter,
+			(strum.chord & GuitarController::Frets::Red)    ? 'R' : fillCharacter,
+			(strum.chord & GuitarController::Frets::Yellow) ? 'Y' : fillCharacter,
+			(strum.chord & GuitarController::Frets::Blue)   ? 'B' : fillCharacter,
+			(strum.chord & GuitarController::Frets::Orange) ? 'O' : fillCharacter,
+			'\0',
+		};
+
+		Serial.print(strum.time);
+		Serial.print(" ms: Strum ");
+		Serial.print(strum.direction == GuitarController::StrumDecoder::Direction::Up ? "up   " : "down ");
+		Serial.println(chordPrint);
+	}
+
+	if (strums.whammyChange() != 0) {
+		Serial.print("Whammy: ");
+		Serial.println(strums.whammyChange());
+	}
+}
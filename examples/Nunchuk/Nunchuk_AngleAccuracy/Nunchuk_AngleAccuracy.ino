@@ -0,0 +1,117 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*  Example:      Nunchuk_AngleAccuracy
+*  Description:  Compare the integer roll and pitch angles against the
+*                floating point versions. Sweeps the full range of the
+*                Nunchuk's 10-bit accelerometer values, printing the
+*                largest error and the time taken by each method.
+*
+*                This uses the same math as 'rollAngleCenti()' and
+*                'pitchAngleCenti()' directly, so it does not need a
+*                controller connected.
+*/
+
+#include <NintendoExtensionCtrl.h>
+
+const uint16_t AccelMax = 1023;   // 10 bits
+const uint16_t AccelCenter = 511;
+const uint8_t  SweepStep = 8;     // Step between tested values, on both axes
+
+const int16_t EdgeCases[][2] = {  // y, x. On and next to the axes, which the sweep steps over
+	{ 0, -5 }, { 0, -511 }, { 1, -511 }, { -1, -511 },
+	{ 0, 5 }, { 5, 0 }, { -5, 0 },
+};
+
+volatile int16_t sinkInt;  // Outputs, so the compiler can't optimize them away
+volatile float sinkFloat;
+
+int16_t maxError = 0;
+uint16_t outOfRange = 0;  // results outside +/- 18000
+unsigned long intTime = 0;
+unsigned long floatTime = 0;
+unsigned long count = 0;
+
+void check(int16_t fixedAngle, float floatAngle) {
+	if (fixedAngle > 18000 || fixedAngle < -18000) outOfRange++;
+
+	int16_t error = abs(fixedAngle - (int16_t) round(floatAngle * 100.0));
+	if (error > 18000) error = 36000 - error;  // wrapped around +/- 180
+	if (error > maxError) maxError = error;
+}
+
+void setup() {
+	Serial.begin(115200);
+	while (!Serial);  // Wait for serial for output
+
+	Serial.println("Sweeping accelerometer range...");
+
+	for (uint16_t x = 0; x <= AccelMax; x += SweepStep) {
+		for (uint16_t z = 0; z <= AccelMax; z += SweepStep) {
+			const int16_t dx = (int16_t) x - AccelCenter;
+			const int16_t dz = (int16_t) z - AccelCenter;
+
+			unsigned long start = micros();
+			const int16_t fixedAngle = NintendoExtensionCtrl::atan2Centi(dx, dz);
+			intTime += micros() - start;
+
+			start = micros();
+			const float floatAngle = atan2((float) dx, (float) dz) * 180.0 / PI;
+			floatTime += micros() - start;
+
+			sinkInt = fixedAngle;
+			sinkFloat = floatAngle;
+
+			check(fixedAngle, floatAngle);
+			count++;
+		}
+	}
+
+	for (uint8_t i = 0; i < sizeof(EdgeCases) / sizeof(EdgeCases[0]); i++) {
+		const int16_t y = EdgeCases[i][0];
+		const int16_t x = EdgeCases[i][1];
+		check(NintendoExtensionCtrl::atan2Centi(y, x), atan2((float) y, (float) x) * 180.0 / PI);
+		count++;
+	}
+
+	Serial.print("Tested ");
+	Serial.print(count);
+	Serial.println(" angles");
+
+	Serial.print("Out of range: ");
+	Serial.println(outOfRange);
+
+	Serial.print("Max error: ");
+	Serial.print(maxError / 100.0, 2);
+	Serial.println(" degrees");
+
+	Serial.print("Integer: ");
+	Serial.print(intTime / count);
+	Serial.print(" us/angle, Float: ");
+	Serial.print(floatTime / count);
+	Serial.println(" us/angle");
+
+	Serial.println("Done!");
+}
+
+void loop() {
+	// Nothing to do here
+}
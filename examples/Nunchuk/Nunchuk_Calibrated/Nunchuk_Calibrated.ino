@@ -0,0 +1,66 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*  Example:      Nunchuk_Calibrated
+*  Description:  Connect to a Nunchuk, read its accelerometer calibration,
+*                and print the calibrated acceleration (in milli-g) and
+*                tilt angles.
+*/
+
+#include <NintendoExtensionCtrl.h>
+
+Nunchuk nchuk;
+
+void setup() {
+	Serial.begin(115200);
+	nchuk.begin();
+	nchuk.setCalibrationOnConnect();  // Read the calibration whenever we connect
+
+	while (!nchuk.connect()) {
+		Serial.println("Nunchuk not detected!");
+		delay(1000);
+	}
+
+	if (nchuk.calibrated()) {
+		Serial.println("Using the Nunchuk's calibration");
+	}
+	else {
+		Serial.println("Calibration is missing or bad, using the defaults");
+	}
+}
+
+void loop() {
+	boolean success = nchuk.update();  // Get new data from the controller
+
+	if (!success) {
+		Serial.println("Controller disconnected!");
+		delay(1000);
+		nchuk.connect();
+	}
+	else {
+		char buffer[64];
+		snprintf(buffer, sizeof(buffer),
+			"mg XYZ:(%5d, %5d, %5d) | Roll: %6d | Pitch: %6d",
+			nchuk.gForceX(), nchuk.gForceY(), nchuk.gForceZ(),
+			nchuk.rollAngleCentiCalibrated(), nchuk.pitchAngleCentiCalibrated());  // centi-degrees
+		Serial.println(buffer);
+	}
+}
@@ -0,0 +1,101 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*  Example:      Nunchuk_Gestures
+*  Description:  Connect to a Nunchuk and watch its accelerometer for
+*                gestures: shaking, swings in each direction, and tilts
+*                that are held in place.
+*/
+
+#include <NintendoExtensionCtrl.h>
+
+Nunchuk nchuk;
+NunchukMotion motion(nchuk);  // Gesture detection for the Nunchuk above
+
+boolean wasShaking = false;
+NunchukMotion::Tilt lastTilt = NunchukMotion::Tilt::None;
+
+const char* swingName(NunchukMotion::Swing swing) {
+	switch (swing) {
+	case NunchukMotion::Swing::Left:    return "left";
+	case NunchukMotion::Swing::Right:   return "right";
+	case NunchukMotion::Swing::Back:    return "back";
+	case NunchukMotion::Swing::Forward: return "forward";
+	case NunchukMotion::Swing::Down:    return "down";
+	case NunchukMotion::Swing::Up:      return "up";
+	default: return "none";
+	}
+}
+
+const char* tiltName(NunchukMotion::Tilt tilt) {
+	switch (tilt) {
+	case NunchukMotion::Tilt::Left:    return "left";
+	case NunchukMotion::Tilt::Right:   return "right";
+	case NunchukMotion::Tilt::Forward: return "forward";
+	case NunchukMotion::Tilt::Back:    return "back";
+	default: return "none";
+	}
+}
+
+void setup() {
+	Serial.begin(115200);
+	nchuk.begin();
+	nchuk.setCalibrationOnConnect();
+
+	while (!nchuk.connect()) {
+		Serial.println("Nunchuk not detected!");
+		delay(1000);
+	}
+
+	motion.setTiltThreshold(3000, 25);  // 30 degrees, held for 25 updates
+}
+
+void loop() {
+	boolean success = nchuk.update();  // Get new data from the controller
+
+	if (!success) {
+		Serial.println("Controller disconnected!");
+		delay(1000);
+		nchuk.connect();
+		motion.reset();  // Start fresh with the new connection
+		return;
+	}
+
+	motion.update();  // Run the new data through the gesture detection
+
+	if (motion.swing() != NunchukMotion::Swing::None) {
+		Serial.print("Swing ");
+		Serial.println(swingName(motion.swing()));
+	}
+
+	if (motion.shaking() != wasShaking) {
+		wasShaking = motion.shaking();
+		Serial.println(wasShaking ? "Shaking!" : "Stopped shaking");
+	}
+
+	if (motion.tilt() != lastTilt) {
+		lastTilt = motion.tilt();
+		Serial.print("Tilt ");
+		Serial.println(tiltName(lastTilt));
+	}
+
+	delay(10);  // ~100 updates per second
+}
@@ -0,0 +1,95 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*  Example:      uDraw_ScreenMapping
+*  Description:  Connect to a uDraw tablet and map the pen to the pixels of
+*                a screen. Start by tapping the four corners of the screen
+*                area on the tablet, in the order asked, and from then on the
+*                pen position is printed in screen coordinates.
+*/
+
+#include <NintendoExtensionCtrl.h>
+
+uDrawTablet tablet;
+TabletCalibration screen(uDrawTablet::PenMax);
+
+const int16_t ScreenWidth = 320;
+const int16_t ScreenHeight = 240;
+
+TabletCalibration::Point corners[4] = {
+	{ 0, 0, 0, 0 },                                 // Top left
+	{ 0, 0, ScreenWidth - 1, 0 },                   // Top right
+	{ 0, 0, ScreenWidth - 1, ScreenHeight - 1 },    // Bottom right
+	{ 0, 0, 0, ScreenHeight - 1 },                  // Bottom left
+};
+
+const char* const CornerNames[4] = { "top left", "top right", "bottom right", "bottom left" };
+
+void waitForTap(uint16_t& x, uint16_t& y) {
+	while (!(tablet.update() && tablet.penDetected() && tablet.penPressure() > 0));  // Pen down
+	x = tablet.penX();
+	y = tablet.penY();
+	while (tablet.update() && tablet.penDetected());  // Pen lifted
+	delay(100);
+}
+
+void setup() {
+	Serial.begin(115200);
+	tablet.begin();
+
+	while (!tablet.connect()) {
+		Serial.println("uDraw Tablet not detected!");
+		delay(1000);
+	}
+
+	do {
+		for (uint8_t i = 0; i < 4; i++) {
+			Serial.print("Tap the ");
+			Serial.print(CornerNames[i]);
+			Serial.println(" corner");
+			waitForTap(corners[i].penX, corners[i].penY);
+		}
+	} while (!screen.calibrate(corners, 4));  // Try again if the taps were in a line
+
+	screen.setScreenSize(ScreenWidth, ScreenHeight);
+
+	Serial.println("Calibrated!");
+}
+
+void loop() {
+	boolean success = tablet.update();  // Get new data from the tablet
+
+	if (!success) {
+		Serial.println("Controller disconnected!");
+		delay(1000);
+		tablet.connect();
+		return;
+	}
+
+	if (!tablet.penDetected()) return;
+
+	int16_t x, y;
+	boolean onScreen = screen.map(tablet.penX(), tablet.penY(), x, y);
+
+	char buffer[40];
+	snprintf(buffer, sizeof(buffer), "Screen: (%3d, %3d)%s", x, y, onScreen ? "" : " - off screen");
+	Serial.println(buffer);
+}
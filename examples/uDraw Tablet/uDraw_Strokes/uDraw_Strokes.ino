@@ -0,0 +1,87 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*  Example:      uDraw_Strokes
+*  Description:  Connect to a uDraw tablet and record the pen strokes as a
+*                simplified line, printing each point as it's kept. At the
+*                end of each stroke it prints how many samples went in and
+*                how many bytes the encoded points would take to send.
+*/
+
+#include <NintendoExtensionCtrl.h>
+
+uDrawTablet tablet;
+uDrawTablet::StrokeRecorder strokes(tablet);  // Pass the object to the stroke recorder
+
+uint32_t strokeBytes = 0;  // Encoded size of the points so far
+
+void setup() {
+	Serial.begin(115200);
+	tablet.begin();
+
+	while (!tablet.connect()) {
+		Serial.println("uDraw Tablet not detected!");
+		delay(1000);
+	}
+
+	strokes.setTolerance(4);  // Samples can be up to 4 counts off the recorded line
+	strokes.setPressureThreshold(0);  // Raise this if hovering the pen draws
+
+	Serial.println("Ready! Draw something");
+}
+
+void loop() {
+	boolean success = tablet.update();  // Get new data from the tablet
+
+	if (!success) {
+		Serial.println("Controller disconnected!");
+		delay(1000);
+		tablet.connect();
+		strokes.reset();
+		return;
+	}
+
+	const boolean wasDrawing = strokes.drawing();
+	strokes.update();  // Add the new sample to the stroke
+
+	uDrawTablet::StrokeRecorder::Point point;
+	while (strokes.read(point)) {
+		uint8_t encoded[uDrawTablet::StrokeRecorder::EncodedMax];
+		strokeBytes += uDrawTablet::StrokeRecorder::encode(point, encoded);
+
+		Serial.print(point.start ? "Start: " : "  ");
+		Serial.print(point.dx);
+		Serial.print(", ");
+		Serial.println(point.dy);
+	}
+
+	if (wasDrawing && !strokes.drawing()) {  // Pen lifted
+		Serial.print("Stroke done. Total ");
+		Serial.print(strokes.getSampleCount());
+		Serial.print(" samples (");
+		Serial.print(strokes.getSampleCount() * 4);  // 2 bytes each for X and Y
+		Serial.print(" bytes) -> ");
+		Serial.print(strokes.getPointCount());
+		Serial.print(" points (");
+		Serial.print(strokeBytes);
+		Serial.println(" bytes)");
+	}
+}
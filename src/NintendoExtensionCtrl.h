@@ -38,4 +38,9 @@
 // Mini Controllers
 /* (included with ClassicController.h) */
 
+// Utilities
+#include "internal/NXC_Scheduler.h"
+#include "internal/NXC_Calibration.h"
+#include "internal/NXC_MIDI.h"
+
 #endif
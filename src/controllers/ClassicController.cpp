@@ -53,6 +53,8 @@ constexpr BitMap  ClassicControllerBase::Maps::ButtonPlus;
 constexpr BitMap  ClassicControllerBase::Maps::ButtonMinus;
 constexpr BitMap  ClassicControllerBase::Maps::ButtonHome;
 
+constexpr BitMap  ClassicControllerBase::Maps::PackedButtons[15];
+
 
 // High Resolution Maps
 constexpr IndexMap ClassicControllerBase::MapsHR::LeftJoyX;
@@ -83,22 +85,73 @@ constexpr BitMap   ClassicControllerBase::MapsHR::ButtonPlus;
 constexpr BitMap   ClassicControllerBase::MapsHR::ButtonMinus;
 constexpr BitMap   ClassicControllerBase::MapsHR::ButtonHome;
 
+constexpr BitMap   ClassicControllerBase::MapsHR::PackedButtons[15];
+
 
-/* Making use of the preprocessor here to repeat these conditionals for every
- * data retrieving function in the class. I'd rather trust the preprocessor
- * here than pass the constexpr objects through a nested function and hope
- * the compiler properly optimizes it. Plus I don't have to trust myself
- * to copy the mapping name twice.
+/* Rather than checking the data mode in every control function, the class
+ * keeps a pointer to a 'view': a table of decoding functions generated at
+ * compile time from either the "standard" maps (Maps::) or the "high
+ * resolution" maps (MapsHR::). The view is picked once, when the data mode
+ * is set, so each control function is a straight call with no branching.
  *
- * If the controller is not in "high resolution" mode (according to the class
- * data), fetch the controlData or controlBit function for the specified map
- * in the "standard" maps (Maps::) and bit shift to the left in order to fit
- * the full width of the "high res" data range. If the controller *is* in
- * "high resolution" mode, fetch the controlData or controlBit function for
- * the specified mapof the same name in the "high resolution" maps (MapsHR::).
+ * Analog values are shifted to the left to fill the full width of the
+ * "high res" data range. The shift is worked out from the width of each map,
+ * so it's zero for the high res maps.
+ *
+ * The buttons are in the same bit positions in both modes, just two bytes
+ * further into the data in "high res" mode. So the single-button functions
+ * use the standard maps and the view's index offset instead of a function call.
  */
-#define HRDATA(map, shift) !highRes ? (getControlData(Maps::map) << shift) & 0xFF : getControlData(MapsHR::map)
-#define HRBIT(map)  !highRes ? getControlBit(Maps::map) : getControlBit(MapsHR::map)
+template<size_t N>
+constexpr bool buttonsOffsetBy(uint8_t offset, const BitMap(&maps)[N], const BitMap(&base)[N], size_t i = 0) {
+	return i >= N || (maps[i].index == base[i].index + offset && maps[i].position == base[i].position
+		&& buttonsOffsetBy(offset, maps, base, i + 1));
+}
+
+static_assert(buttonsOffsetBy(2, ClassicControllerBase::MapsHR::PackedButtons, ClassicControllerBase::Maps::PackedButtons),
+	"High res buttons must be the standard buttons, two bytes further in");
+
+#define VIEWDATA(map) (uint8_t) (c.getControlData(MapSet::map) << (8 - bitWidth(MapSet::map)))
+
+template<class MapSet>
+struct ClassicControllerBase::View {
+	static uint8_t leftJoyX(const ClassicControllerBase& c) { return VIEWDATA(LeftJoyX); }
+	static uint8_t leftJoyY(const ClassicControllerBase& c) { return VIEWDATA(LeftJoyY); }
+
+	static uint8_t rightJoyX(const ClassicControllerBase& c) { return VIEWDATA(RightJoyX); }
+	static uint8_t rightJoyY(const ClassicControllerBase& c) { return VIEWDATA(RightJoyY); }
+
+	static uint8_t triggerL(const ClassicControllerBase& c) { return VIEWDATA(TriggerL); }
+	static uint8_t triggerR(const ClassicControllerBase& c) { return VIEWDATA(TriggerR); }
+
+	static uint16_t buttons(const ClassicControllerBase& c) { return c.getControlBits<MapSet>(); }
+
+	static void decode(const ClassicControllerBase& c, State& state) {
+		state.leftJoyX  = VIEWDATA(LeftJoyX);
+		state.leftJoyY  = VIEWDATA(LeftJoyY);
+		state.rightJoyX = VIEWDATA(RightJoyX);
+		state.rightJoyY = VIEWDATA(RightJoyY);
+		state.triggerL  = VIEWDATA(TriggerL);
+		state.triggerR  = VIEWDATA(TriggerR);
+		state.buttons   = c.getControlBits<MapSet>();
+	}
+
+	constexpr static DataView table() {
+		return {
+			&View::leftJoyX, &View::leftJoyY,
+			&View::rightJoyX, &View::rightJoyY,
+			&View::triggerL, &View::triggerR,
+			&View::buttons, &View::decode,
+			(uint8_t) (MapSet::DpadUp.index - Maps::DpadUp.index),
+		};
+	}
+};
+
+const ClassicControllerBase::DataView ClassicControllerBase::StandardView PROGMEM = View<Maps>::table();
+const ClassicControllerBase::DataView ClassicControllerBase::HighResView PROGMEM = View<MapsHR>::table();
+
+// The views are kept in PROGMEM rather than RAM, so each function pointer is read from flash before it's called
+#define VIEWFN(fn) reinterpret_cast<decltype(DataView::fn)>(pgm_read_ptr(&view->fn))
 
 
 boolean ClassicControllerBase::specificInit() {
@@ -114,6 +167,16 @@ boolean ClassicControllerBase::specificInit() {
 	 * return false if the "high resolution" mode is not successfully set.
 	 */
 	delayMicroseconds(I2C_ConversionDelay);  // wait after ID read before writing register
+
+	/* With passive detection on, the data mode isn't verified here. The class
+	 * assumes that the controller took the 'high res' setting and then checks
+	 * that assumption against the data from each update, see 'detectDataMode'.
+	 */
+	if (passiveDetect) {
+		detectFrames = detectHits = 0;  // fresh window for the new connection
+		return setDataMode(true, false);
+	}
+
 	return setDataMode(true);  // try to set 'high res' mode. 'success' if no comms errors
 }
 
@@ -155,7 +218,9 @@ boolean ClassicControllerBase::checkDataMode(boolean *hr) const {
 	 *
 	 * To mitigate this, the same data set is requested twice and compared
 	 * against itself. If there is a data mismatch, the requests are repeated
-	 * until the two arrays agree. Not perfect, but better than nothing.
+	 * until the two arrays agree. Not perfect, but better than nothing. If
+	 * they still don't agree after a few tries the bus is too noisy to tell,
+	 * and this gives up rather than stalling the program.
 	 *
 	 * Note that this read starts at 0x00. I tried starting at where the data
 	 * *actually starts* (bytes 7 and 8, i.e. ptr 0x06), but the knockoff
@@ -165,7 +230,9 @@ boolean ClassicControllerBase::checkDataMode(boolean *hr) const {
 	 */
 	static const uint8_t CheckSize  = 8;     // 8 bytes to cover both std and high res
 	static const uint8_t DataOffset = 0x06;  // start of the data we're interested in (7 / 8)
+	static const uint8_t MaxAttempts = 8;    // pairs of reads before giving up
 	uint8_t checkData[CheckSize] = { 0x00 }, verifyData[CheckSize] = { 0x00 };
+	uint8_t attempts = 0;
 	do {
 		if (!requestControlData(CheckSize, checkData)) return false;
 		delayMicroseconds(I2C_ConversionDelay);  // need a brief delay between reads
@@ -180,6 +247,7 @@ boolean ClassicControllerBase::checkDataMode(boolean *hr) const {
 		}
 
 		if (equal) break;  // if data matches, continue
+		if (++attempts >= MaxAttempts) return false;  // error: reads never agreed
 		delayMicroseconds(I2C_ConversionDelay);  // if we're doing another loop, wait between reads again
 	} while (true);
 
@@ -187,6 +255,54 @@ boolean ClassicControllerBase::checkDataMode(boolean *hr) const {
 	return true;  // successfully read state
 }
 
+boolean ClassicControllerBase::identityTrusted() const {
+	/* Genuine controllers switch modes when asked and send clean data, so a
+	 * single frame is enough to tell which mode they're in. Plenty of
+	 * knockoffs don't, so they get the full 'checkDataMode' treatment.
+	 *
+	 * Knockoffs also copy whatever ID they like, so this can't pick out every
+	 * genuine controller. It's only a list of the ID's first byte (saved by
+	 * 'connect()', so it costs no extra reads) for the models that are known
+	 * to behave.
+	 */
+	struct ModeQuirk {
+		uint8_t id;        // ID byte 0
+		boolean trusted;   // whether one frame shows the data mode reliably
+	};
+
+	static const ModeQuirk Quirks[] = {
+		{ 0x00, false },  // original Classic Controller ID, shared by most knockoffs
+		{ 0x01, true  },  // Classic Controller Pro and the NES / SNES mini controllers
+	};
+
+	for (uint8_t i = 0; i < sizeof(Quirks) / sizeof(Quirks[0]); i++) {
+		if (Quirks[i].id == getControllerSubtype()) return Quirks[i].trusted;
+	}
+	return false;  // not in the table
+}
+
+boolean ClassicControllerBase::checkFrameMode(boolean *hr, boolean *known) const {
+	/* Each mode has bits that are fixed in its data: in "high res" mode bit 0
+	 * of byte 7 is always '1', and in "standard" mode bytes 7-8 are blank and
+	 * bit 0 of byte 5 is always '1'. One frame that matches exactly one of
+	 * those is enough to know the mode. Third party mini controllers copy
+	 * the genuine ID, so this is checked against the data rather than the
+	 * ID's own mode byte, which they'll set to whatever they were asked for.
+	 *
+	 * '*known' is false if the frame doesn't match either mode, in which case
+	 * it's up to 'checkDataMode' to sort out.
+	 */
+	uint8_t frame[MaxRequestSize];
+	if (!requestControlData(MaxRequestSize, frame)) return false;
+
+	const boolean frameHighRes = (frame[6] & 0x01);  // fixed '1' bit in high res mode
+	const boolean frameStandard = frame[6] == 0x00 && frame[7] == 0x00 && (frame[4] & 0x01);  // blank, and fixed '1' bit
+
+	*known = (frameHighRes != frameStandard);
+	*hr = frameHighRes;
+	return true;
+}
+
 boolean ClassicControllerBase::setDataMode(boolean hr, boolean verify) {
 	const uint8_t regVal = hr ? 0x03 : 0x01;  // 0x03 for high res, 0x01 for standard
 
@@ -215,16 +331,23 @@ boolean ClassicControllerBase::setDataMode(boolean hr, boolean verify) {
 	}
 
 	if (verify == true) {
-		boolean currentMode;  // buffer for controller's deduced HR setting, set in the 'check' function
-		if (!checkDataMode(&currentMode)) return false;  // error: could not read mode
-		highRes = currentMode;  // save current mode to class
+		boolean currentMode;  // buffer for controller's deduced HR setting, set in the 'check' functions
+		boolean known = false;
+
+		// trusted controllers only need one frame. Otherwise (or if that frame is unclear) check the data properly
+		if (writeSuccess && identityTrusted()) {
+			if (!checkFrameMode(&currentMode, &known)) return false;  // error: could not read frame
+			if (!known) delayMicroseconds(I2C_ConversionDelay);  // wait before reading again
+		}
+		if (!known && !checkDataMode(&currentMode)) return false;  // error: could not read mode
+		setView(currentMode);  // save current mode to class
 	}
 	else {
-		highRes = hr;  // save mode we're attempting to set (no verification)
+		setView(hr);  // save mode we're attempting to set (no verification)
 	}
 
-	if (getHighRes() == true && getRequestSize() < 8) {
-		setRequestSize(8);  // 8 bytes needed for hr mode
+	if (getHighRes() == true && getRequestSize() < MaxRequestSize) {
+		setRequestSize(MaxRequestSize);  // 8 bytes needed for hr mode
 	}
 	else if (getHighRes() == false && hr == false) {
 		setRequestSize(MinRequestSize);  // if not in HR and *trying* not to be, set back to min
@@ -242,76 +365,114 @@ boolean ClassicControllerBase::getHighRes() const {
 	return highRes;
 }
 
+void ClassicControllerBase::specificUpdate() {
+	if (passiveDetect) detectDataMode();
+}
+
+void ClassicControllerBase::setPassiveDetection(boolean enable) {
+	passiveDetect = enable;
+	detectFrames = detectHits = 0;
+}
+
+boolean ClassicControllerBase::getPassiveDetection() const {
+	return passiveDetect;
+}
+
+void ClassicControllerBase::detectDataMode() {
+	/* This uses the same idea as 'checkDataMode' above: in "standard" mode
+	 * bytes 7 and 8 are blank, in "high resolution" mode they hold the
+	 * button data. But instead of making extra requests until two of them
+	 * agree, this looks at the data that's already been read for each update.
+	 *
+	 * Each update counts as a vote for one mode or the other. After a full
+	 * window of updates the mode is switched if nearly all of them disagree
+	 * with the current setting, so a few flipped bits from bus noise won't
+	 * change it. Either way it never makes any extra requests or waits.
+	 *
+	 * The request size is left at 8 bytes even after switching to "standard"
+	 * mode so that the check can keep running.
+	 */
+	if (getRequestSize() < MaxRequestSize) return;  // not enough data to tell
+
+	if (getControlData(6) != 0x00 || getControlData(7) != 0x00) detectHits++;
+	if (++detectFrames < DetectWindow) return;  // window not done yet
+
+	if (!highRes && detectHits >= DetectWindow - DetectNoise) setView(true);
+	else if (highRes && detectHits <= DetectNoise) setView(false);
+
+	detectFrames = detectHits = 0;
+}
+
 uint8_t ClassicControllerBase::leftJoyX() const {
-	return HRDATA(LeftJoyX, 2);  // 6 bits for standard range, so shift left (8-6)
+	return VIEWFN(leftJoyX)(*this);
 }
 
 uint8_t ClassicControllerBase::leftJoyY() const {
-	return HRDATA(LeftJoyY, 2);
+	return VIEWFN(leftJoyY)(*this);
 }
 
 uint8_t ClassicControllerBase::rightJoyX() const {
-	return HRDATA(RightJoyX, 3);  // 5 bits for standard range, so shift left (8-5)
+	return VIEWFN(rightJoyX)(*this);
 }
 
 uint8_t ClassicControllerBase::rightJoyY() const {
-	return HRDATA(RightJoyY, 3);
+	return VIEWFN(rightJoyY)(*this);
 }
 
 boolean ClassicControllerBase::dpadUp() const {
-	return HRBIT(DpadUp);
+	return getButton(Maps::DpadUp);
 }
 
 boolean ClassicControllerBase::dpadDown() const {
-	return HRBIT(DpadDown);
+	return getButton(Maps::DpadDown);
 }
 
 boolean ClassicControllerBase::dpadLeft() const {
-	return HRBIT(DpadLeft);
+	return getButton(Maps::DpadLeft);
 }
 
 boolean ClassicControllerBase::dpadRight() const {
-	return HRBIT(DpadRight);
+	return getButton(Maps::DpadRight);
 }
 
 boolean ClassicControllerBase::buttonA() const {
-	return HRBIT(ButtonA);
+	return getButton(Maps::ButtonA);
 }
 
 boolean ClassicControllerBase::buttonB() const {
-	return HRBIT(ButtonB);
+	return getButton(Maps::ButtonB);
 }
 
 boolean ClassicControllerBase::buttonX() const {
-	return HRBIT(ButtonX);
+	return getButton(Maps::ButtonX);
 }
 
 boolean ClassicControllerBase::buttonY() const {
-	return HRBIT(ButtonY);
+	return getButton(Maps::ButtonY);
 }
 
 uint8_t ClassicControllerBase::triggerL() const {
-	return HRDATA(TriggerL, 3);  // 5 bits for standard range, so shift left (8-5)
+	return VIEWFN(triggerL)(*this);
 }
 
 uint8_t ClassicControllerBase::triggerR() const {
-	return HRDATA(TriggerR, 3);
+	return VIEWFN(triggerR)(*this);
 }
 
 boolean ClassicControllerBase::buttonL() const {
-	return HRBIT(ButtonL);
+	return getButton(Maps::ButtonL);
 }
 
 boolean ClassicControllerBase::buttonR() const {
-	return HRBIT(ButtonR);
+	return getButton(Maps::ButtonR);
 }
 
 boolean ClassicControllerBase::buttonZL() const {
-	return HRBIT(ButtonZL);
+	return getButton(Maps::ButtonZL);
 }
 
 boolean ClassicControllerBase::buttonZR() const {
-	return HRBIT(ButtonZR);
+	return getButton(Maps::ButtonZR);
 }
 
 boolean ClassicControllerBase::buttonStart() const {
@@ -323,15 +484,32 @@ boolean ClassicControllerBase::buttonSelect() const {
 }
 
 boolean ClassicControllerBase::buttonPlus() const {
-	return HRBIT(ButtonPlus);
+	return getButton(Maps::ButtonPlus);
 }
 
 boolean ClassicControllerBase::buttonMinus() const {
-	return HRBIT(ButtonMinus);
+	return getButton(Maps::ButtonMinus);
 }
 
 boolean ClassicControllerBase::buttonHome() const {
-	return HRBIT(ButtonHome);
+	return getButton(Maps::ButtonHome);
+}
+
+uint16_t ClassicControllerBase::buttons() const {
+	return VIEWFN(buttons)(*this);
+}
+
+void ClassicControllerBase::decode(State& state) const {
+	VIEWFN(decode)(*this, state);
+}
+
+boolean ClassicControllerBase::getButton(const BitMap map) const {
+	return getControlBit(BitMap{ (uint8_t) (map.index + pgm_read_byte(&view->buttonOffset)), map.position });
+}
+
+void ClassicControllerBase::setView(boolean hr) {
+	highRes = hr;
+	view = hr ? &HighResView : &StandardView;  // pick decoding functions for the mode
 }
 
 void ClassicControllerBase::printDebug(Print& output) const {
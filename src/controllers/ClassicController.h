@@ -65,6 +65,12 @@ namespace NintendoExtensionCtrl {
 			constexpr static BitMap  ButtonPlus = { 4, 2 };
 			constexpr static BitMap  ButtonMinus = { 4, 4 };
 			constexpr static BitMap  ButtonHome = { 4, 3 };
+
+			constexpr static BitMap  PackedButtons[15] = {  // Order of 'Buttons' bits
+				DpadUp, DpadDown, DpadLeft, DpadRight,
+				ButtonA, ButtonB, ButtonX, ButtonY,
+				ButtonL, ButtonR, ButtonZL, ButtonZR,
+				ButtonPlus, ButtonMinus, ButtonHome };
 		};
 
 		struct MapsHR {
@@ -106,10 +112,54 @@ namespace NintendoExtensionCtrl {
 			constexpr static BitMap   ButtonPlus = { 6, 2 };
 			constexpr static BitMap   ButtonMinus = { 6, 4 };
 			constexpr static BitMap   ButtonHome = { 6, 3 };
+
+			constexpr static BitMap   PackedButtons[15] = {  // Order of 'Buttons' bits
+				DpadUp, DpadDown, DpadLeft, DpadRight,
+				ButtonA, ButtonB, ButtonX, ButtonY,
+				ButtonL, ButtonR, ButtonZL, ButtonZR,
+				ButtonPlus, ButtonMinus, ButtonHome };
+		};
+
+		struct Buttons {  // Bits for the packed button mask
+			enum : uint16_t {
+				DpadUp      = 1 << 0,
+				DpadDown    = 1 << 1,
+				DpadLeft    = 1 << 2,
+				DpadRight   = 1 << 3,
+
+				ButtonA     = 1 << 4,
+				ButtonB     = 1 << 5,
+				ButtonX     = 1 << 6,
+				ButtonY     = 1 << 7,
+
+				ButtonL     = 1 << 8,
+				ButtonR     = 1 << 9,
+				ButtonZL    = 1 << 10,
+				ButtonZR    = 1 << 11,
+
+				ButtonPlus  = 1 << 12,
+				ButtonMinus = 1 << 13,
+				ButtonHome  = 1 << 14,
+			};
+		};
+
+		struct State {  // All controls, decoded at once
+			uint8_t leftJoyX;  // 8 bits, shifted in std mode
+			uint8_t leftJoyY;
+
+			uint8_t rightJoyX;
+			uint8_t rightJoyY;
+
+			uint8_t triggerL;
+			uint8_t triggerR;
+
+			uint16_t buttons;  // Packed, see 'Buttons'. '1' is pressed.
 		};
 
 		using ExtensionController::ExtensionController;
 
+		static const uint8_t MaxRequestSize = 8;  // High resolution mode, sizes the control data
+
 		boolean specificInit();
 
 		ExtensionType getExpectedType() const;
@@ -117,6 +167,9 @@ namespace NintendoExtensionCtrl {
 		boolean setHighRes(boolean hr = true, boolean verify = true);
 		boolean getHighRes() const;
 
+		void setPassiveDetection(boolean enable = true);  // Detect the data mode from updates, set before connecting
+		boolean getPassiveDetection() const;
+
 		uint8_t leftJoyX() const;  // 8 bits, 6 shifted in std mode
 		uint8_t leftJoyY() const;
 
@@ -150,13 +203,55 @@ namespace NintendoExtensionCtrl {
 
 		boolean buttonHome() const;
 
+		uint16_t buttons() const;  // Packed, see 'Buttons'. '1' is pressed.
+
+		void decode(State& state) const;  // Decode all controls to a State struct
+
 		void printDebug(Print& output = NXC_SERIAL_DEFAULT) const;
 
 	protected:
+		void specificUpdate();  // passive data mode detection, if enabled
+
 		boolean highRes = false;  // 'high resolution' mode setting
 
 		boolean checkDataMode(boolean *hr) const;
+		boolean identityTrusted() const;  // 'true' if this model's data can be checked from one frame
+		boolean checkFrameMode(boolean *hr, boolean *known) const;  // 'false' on a bad read
 		boolean setDataMode(boolean hr, boolean verify = true);
+
+		void detectDataMode();  // Passive mode check, using the last update
+
+		static const uint8_t DetectWindow = 8;  // Number of updates per detection window
+		static const uint8_t DetectNoise = 1;   // Number of updates per window that can disagree
+
+		boolean passiveDetect = false;
+		uint8_t detectFrames = 0;  // Updates seen in the current window
+		uint8_t detectHits = 0;    // Updates in the current window with high res data
+
+	private:
+		template<class MapSet> struct View;  // decoding functions for one set of maps, see source
+
+		struct DataView {
+			uint8_t (*leftJoyX)(const ClassicControllerBase&);
+			uint8_t (*leftJoyY)(const ClassicControllerBase&);
+			uint8_t (*rightJoyX)(const ClassicControllerBase&);
+			uint8_t (*rightJoyY)(const ClassicControllerBase&);
+			uint8_t (*triggerL)(const ClassicControllerBase&);
+			uint8_t (*triggerR)(const ClassicControllerBase&);
+			uint16_t (*buttons)(const ClassicControllerBase&);
+			void (*decode)(const ClassicControllerBase&, State&);
+
+			uint8_t buttonOffset;  // Button data index, relative to the standard maps
+		};
+
+		static const DataView StandardView;
+		static const DataView HighResView;
+
+		const DataView * view = &StandardView;  // View for the current data mode, points to PROGMEM
+
+		boolean getButton(const BitMap map) const;  // Standard button map, offset by the view
+
+		void setView(boolean hr);  // Save the data mode and pick its view
 	};
 
 
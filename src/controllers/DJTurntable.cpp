@@ -47,6 +47,8 @@ constexpr ByteMap DJTurntableControllerBase::Maps::CrossfadeSlider;
 
 constexpr BitMap  DJTurntableControllerBase::Maps::ButtonEuphoria;
 
+constexpr BitMap  DJTurntableControllerBase::Maps::PackedButtons[9];
+
 ExtensionType DJTurntableControllerBase::getExpectedType() const {
 	return ExtensionType::DJTurntableController;
 }
@@ -97,6 +99,23 @@ boolean DJTurntableControllerBase::buttonMinus() const {
 	return getControlBit(Maps::ButtonMinus);
 }
 
+uint16_t DJTurntableControllerBase::buttons() const {
+	return getControlBits<Maps>();
+}
+
+void DJTurntableControllerBase::decode(State& state) const {
+	state.joyX = getControlData(Maps::JoyX);
+	state.joyY = getControlData(Maps::JoyY);
+
+	state.leftTurntable = left.turntable();
+	state.rightTurntable = right.turntable();
+
+	state.effectDial = getControlData(Maps::EffectDial);
+	state.crossfadeSlider = getControlData(Maps::CrossfadeSlider);
+
+	state.buttons = buttons();
+}
+
 DJTurntableControllerBase::TurntableConfig DJTurntableControllerBase::getTurntableConfig() {
 	if (tableConfig == TurntableConfig::Both) {
 		return tableConfig;  // Both are attached, no reason to check data
@@ -244,7 +263,84 @@ boolean DJTurntableControllerBase::TurntableRight::buttonBlue() const {
 
 // Effect Rollover
 int8_t DJTurntableControllerBase::EffectRollover::getChange() {
-	return RolloverChange::getChange(dj.effectDial());
+	const uint8_t dial = dj.effectDial();
+	tracker.update(&dial);
+	return tracker.getChange(0);
+}
+
+// Turntable Tracker
+void DJTurntableControllerBase::TurntableTracker::update() {
+	/* The turntable reports the ticks it has moved since the last read,
+	 * which tops out around +/- 30. Adding them up gives the platter's
+	 * position, as long as the reads are fast enough: if the count hits
+	 * the limit then the platter may have turned further than it can
+	 * report, and that rotation is lost. At ~900 ticks per revolution
+	 * that's about 2 revolutions per second for every 100 updates per
+	 * second.
+	 *
+	 * The speed is kept as two running averages, ticks per update and
+	 * time per update, so that each update is just a few adds and shifts.
+	 * The division to ticks per second is only done when it's asked for.
+	 */
+	const int8_t change = turntable.turntable();
+	const unsigned long now = micros();
+
+	ticks += change;
+
+	saturated = (change >= 29 || change <= -30);
+	if (saturated && overruns != 0xFFFF) overruns++;
+
+	if (!primed) {  // no time reference yet, so no speed
+		primed = true;
+	}
+	else {
+		const uint32_t period = now - lastTime;
+		tickAverage += ((int32_t) change << 8) - (tickAverage >> SpeedShift);
+		periodAverage += period - (periodAverage >> SpeedShift);
+	}
+	lastTime = now;
+}
+
+void DJTurntableControllerBase::TurntableTracker::reset() {
+	ticks = 0;
+	tickAverage = 0;
+	periodAverage = 0;
+	primed = false;
+	saturated = false;
+	overruns = 0;
+}
+
+int32_t DJTurntableControllerBase::TurntableTracker::position() const {
+	return ticks;
+}
+
+int32_t DJTurntableControllerBase::TurntableTracker::revolutions() const {
+	int32_t revs = ticks / ticksPerRev;
+	if (ticks < 0 && revs * ticksPerRev != ticks) revs--;  // round down, not towards zero
+	return revs;
+}
+
+uint16_t DJTurntableControllerBase::TurntableTracker::angle() const {
+	const int32_t within = ticks - (revolutions() * ticksPerRev);  // 0 to ticksPerRev - 1
+	return (uint32_t) within * 360 / ticksPerRev;
+}
+
+int16_t DJTurntableControllerBase::TurntableTracker::velocity() const {
+	if (periodAverage == 0) return 0;  // no timing yet
+	// Both averages carry the same smoothing shift, so it cancels out. The tick average is << 8.
+	return (int32_t) (tickAverage * (1000000 >> 8)) / (int32_t) periodAverage;
+}
+
+boolean DJTurntableControllerBase::TurntableTracker::tooSlow() const {
+	return saturated;
+}
+
+uint16_t DJTurntableControllerBase::TurntableTracker::getOverruns() const {
+	return overruns;
+}
+
+void DJTurntableControllerBase::TurntableTracker::setTicksPerRevolution(uint16_t t) {
+	if (t != 0) ticksPerRev = t;
 }
 
 }  // End "NintendoExtensionCtrl" namespace
@@ -53,11 +53,49 @@ namespace NintendoExtensionCtrl {
 			constexpr static ByteMap CrossfadeSlider = ByteMap(2, 4, 1, 1);
 
 			constexpr static BitMap  ButtonEuphoria = { 5, 4 };
+
+			constexpr static BitMap  PackedButtons[9] = {  // Order of 'Buttons' bits
+				Left_ButtonGreen, Left_ButtonRed, Left_ButtonBlue,
+				Right_ButtonGreen, Right_ButtonRed, Right_ButtonBlue,
+				ButtonEuphoria,
+				ButtonPlus, ButtonMinus };
+		};
+
+		struct Buttons {  // Bits for the packed button mask
+			enum : uint16_t {
+				Left_ButtonGreen  = 1 << 0,
+				Left_ButtonRed    = 1 << 1,
+				Left_ButtonBlue   = 1 << 2,
+
+				Right_ButtonGreen = 1 << 3,
+				Right_ButtonRed   = 1 << 4,
+				Right_ButtonBlue  = 1 << 5,
+
+				ButtonEuphoria    = 1 << 6,
+
+				ButtonPlus        = 1 << 7,
+				ButtonMinus       = 1 << 8,
+			};
+		};
+
+		struct State {  // All controls, decoded at once
+			uint8_t joyX;
+			uint8_t joyY;
+
+			int8_t leftTurntable;
+			int8_t rightTurntable;
+
+			uint8_t effectDial;
+			uint8_t crossfadeSlider;
+
+			uint16_t buttons;  // Packed, see 'Buttons'. '1' is pressed.
 		};
 
 		DJTurntableControllerBase(ExtensionData& dataRef) : 
 			ExtensionController(dataRef), left(*this), right(*this) {}
 
+		static const uint8_t MaxRequestSize = MinRequestSize;  // Sizes the control data
+
 		ExtensionType getExpectedType() const;
 
 		enum class TurntableConfig {
@@ -84,6 +122,10 @@ namespace NintendoExtensionCtrl {
 		boolean buttonPlus() const;
 		boolean buttonMinus() const;
 
+		uint16_t buttons() const;  // Packed, see 'Buttons'. '1' is pressed.
+
+		void decode(State& state) const;  // Decode all controls to a State struct
+
 		void printDebug(Print& output = NXC_SERIAL_DEFAULT);
 
 		TurntableConfig getTurntableConfig();
@@ -135,14 +177,49 @@ namespace NintendoExtensionCtrl {
 			boolean buttonBlue() const;
 		} right;
 
-		class EffectRollover : private NintendoExtensionCtrl::RolloverChange {
+		class EffectRollover {
 		public:
-			EffectRollover(DJTurntableControllerBase & controller) : RolloverChange(0, 31), dj(controller) {}
+			EffectRollover(DJTurntableControllerBase & controller) : dj(controller) {}
 			int8_t getChange();
 		private:
+			NintendoExtensionCtrl::RolloverTracker<1, 5, int16_t> tracker;  // 5 bits, 0-31
 			const DJTurntableControllerBase & dj;
 		};
 
+		class TurntableTracker {  // Platter position and speed, from the turntable ticks
+		public:
+			TurntableTracker(const TurntableExpansion & table) : turntable(table) {}
+
+			void update();  // Call once after each controller update
+			void reset();
+
+			int32_t position() const;  // Total ticks since reset. Clockwise = positive.
+			int32_t revolutions() const;  // Whole revolutions, rounded down
+			uint16_t angle() const;  // 0-359 degrees, within the current revolution
+
+			int16_t velocity() const;  // Ticks per second, filtered
+			boolean tooSlow() const;  // 'true' if the last update may have missed some rotation
+			uint16_t getOverruns() const;  // Number of updates that may have missed rotation
+
+			void setTicksPerRevolution(uint16_t ticks);
+
+			static const uint8_t SpeedShift = 2;  // Velocity smoothing, 1/4 per update
+
+		private:
+			const TurntableExpansion & turntable;
+
+			uint16_t ticksPerRev = 900;
+
+			int32_t ticks = 0;
+			int32_t tickAverage = 0;     // Ticks per update, << 8 and << SpeedShift
+			uint32_t periodAverage = 0;  // Microseconds per update, << SpeedShift
+			unsigned long lastTime = 0;
+			boolean primed = false;      // Timing starts from the first update
+
+			boolean saturated = false;
+			uint16_t overruns = 0;
+		};
+
 	private:
 		void printTurntable(Print& output, TurntableExpansion &table) const;
 
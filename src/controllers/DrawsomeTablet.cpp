@@ -62,6 +62,14 @@ boolean DrawsomeTabletBase::penDetected() const {
 	return getControlBit(Maps::Pen_Detected);
 }
 
+void DrawsomeTabletBase::decode(State& state) const {
+	state.penX = (getControlData(Maps::PenX_MSB) << 8) | getControlData(Maps::PenX_LSB);
+	state.penY = (getControlData(Maps::PenY_MSB) << 8) | getControlData(Maps::PenY_LSB);
+	state.penPressure = (getControlData(Maps::Pressure_MSB) << 8) | getControlData(Maps::Pressure_LSB);
+
+	state.penDetected = getControlBit(Maps::Pen_Detected);
+}
+
 void DrawsomeTabletBase::printDebug(Print& output) const {
 	char buffer[60];
 	
@@ -75,4 +83,9 @@ void DrawsomeTabletBase::printDebug(Print& output) const {
 	output.println(buffer);
 }
 
+void DrawsomeTabletBase::StrokeRecorder::update() {
+	const boolean down = tablet.penDetected() && tablet.penPressure() > pressureThreshold;
+	addSample(tablet.penX(), tablet.penY(), down);
+}
+
 }  // End "NintendoExtensionCtrl" namespace
@@ -24,6 +24,7 @@
 #define NXC_DRAWSOMETABLET_H
 
 #include "internal/ExtensionController.h"
+#include "internal/NXC_Strokes.h"
 
 namespace NintendoExtensionCtrl {
 	class DrawsomeTabletBase : public ExtensionController {
@@ -40,9 +41,21 @@ namespace NintendoExtensionCtrl {
 
 			constexpr static BitMap   Pen_Detected = {5, 7};
 		};
+
+		struct State {  // All controls, decoded at once
+			uint16_t penX;
+			uint16_t penY;
+			uint16_t penPressure;
+
+			boolean penDetected;
+		};
 		
 		using ExtensionController::ExtensionController;
 
+		static const uint8_t MaxRequestSize = MinRequestSize;  // Sizes the control data
+
+		static const uint16_t PenMax = 65535;  // Largest 'penX()' / 'penY()' value
+
 		boolean specificInit();  // for required register writes at init
 
 		ExtensionType getExpectedType() const;
@@ -54,7 +67,22 @@ namespace NintendoExtensionCtrl {
 
 		boolean  penDetected() const;
 
+		void decode(State& state) const;  // Decode all controls to a State struct
+
 		void printDebug(Print& output = NXC_SERIAL_DEFAULT) const;
+
+		class StrokeRecorder : public StrokeRecorderBase {  // Simplified pen strokes, see 'StrokeRecorderBase'
+		public:
+			StrokeRecorder(const DrawsomeTabletBase & controller)
+				: StrokeRecorderBase(DefaultTolerance), tablet(controller) {}
+
+			void update();  // Call once after each controller update
+
+			static const uint8_t DefaultTolerance = 16;
+
+		private:
+			const DrawsomeTabletBase & tablet;
+		};
 	};
 }
 
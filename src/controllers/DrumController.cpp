@@ -43,6 +43,8 @@ constexpr ByteMap DrumControllerBase::Maps::Velocity;
 constexpr ByteMap DrumControllerBase::Maps::VelocityID;
 constexpr BitMap  DrumControllerBase::Maps::VelocityAvailable;
 
+constexpr BitMap  DrumControllerBase::Maps::PackedButtons[8];
+
 ExtensionType DrumControllerBase::getExpectedType() const {
 	return ExtensionType::DrumController;
 }
@@ -87,6 +89,10 @@ boolean DrumControllerBase::buttonMinus() const {
 	return getControlBit(Maps::ButtonMinus);
 }
 
+uint16_t DrumControllerBase::buttons() const {
+	return getControlBits<Maps>();
+}
+
 boolean DrumControllerBase::velocityAvailable() const {
 	return getControlBit(Maps::VelocityAvailable);
 }
@@ -157,6 +163,171 @@ uint8_t DrumControllerBase::velocityPedal() const {
 	return velocity(VelocityID::Pedal);
 }
 
+void DrumControllerBase::decode(State& state) const {
+	state.joyX = getControlData(Maps::JoyX);
+	state.joyY = getControlData(Maps::JoyY);
+
+	if (velocityAvailable()) {
+		state.velocityID = velocityID();
+		state.velocity = 7 - getControlData(Maps::Velocity);  // Invert so high = fast attack
+	}
+	else {
+		state.velocityID = VelocityID::None;
+		state.velocity = 0;
+	}
+
+	state.buttons = buttons();
+}
+
+// Hit Decoder
+const DrumControllerBase::VelocityID DrumControllerBase::HitDecoder::PadIDs[NumPads] = {
+	VelocityID::Red, VelocityID::Blue, VelocityID::Green,
+	VelocityID::Yellow, VelocityID::Orange, VelocityID::Pedal,
+};
+
+void DrumControllerBase::HitDecoder::update() {
+	/* The drums report which pads are hit as regular button bits, but the
+	 * velocity for a hit comes separately, for one pad at a time. During a
+	 * fast roll the velocity for one pad can show up a few updates after
+	 * its button bit, or (if the updates are slow) without the bit ever
+	 * being seen at all.
+	 *
+	 * So each pad goes through a small state machine. A rising button bit
+	 * marks the pad as 'pending' until its velocity shows up. A new velocity
+	 * report for a pad sends its hit, pending or not, and then 'latches' the
+	 * pad so the same hit isn't sent twice while the data is still there.
+	 * The latch is released when the pad bit falls, or once the bit is off
+	 * and the velocity data has moved on to another pad.
+	 *
+	 * If the velocity report doesn't change (the same pad hit again, just as
+	 * hard) there's nothing new to see in the velocity data. So a pending pad
+	 * that times out while the report is still for that pad is sent with
+	 * that velocity. A pending pad that doesn't get any velocity in time is
+	 * sent without one and counted as missed, since that means the updates
+	 * are too far apart to catch every velocity.
+	 *
+	 * Either way the hit has already been sent by the time its own velocity
+	 * shows up (if it ever does), so the pad is marked 'late' and the next
+	 * new velocity for it is dropped rather than sent as a second hit. That
+	 * mark is cleared when the pad is hit again.
+	 */
+	const unsigned long now = millis();
+	const uint8_t pressed = drums.buttons() & ((1 << NumPads) - 1);
+
+	uint8_t velocityPad = NumPads;  // pad index for the velocity data, if any
+	uint8_t velocity = 0;
+
+	if (drums.velocityAvailable()) {
+		const VelocityID id = drums.velocityID();
+		for (uint8_t i = 0; i < NumPads; i++) {
+			if (PadIDs[i] == id) {
+				velocity = drums.velocity();
+				if (velocity != 0) velocityPad = i;  // '0' is "not hit", not a report
+				break;
+			}
+		}
+	}
+
+	const boolean freshVelocity = (velocityPad != lastPad || velocity != lastVelocity);
+	lastPad = velocityPad;
+	lastVelocity = velocity;
+
+	missedLast = false;
+
+	for (uint8_t i = 0; i < NumPads; i++) {
+		const uint8_t mask = 1 << i;
+
+		if ((pressed & mask) && !(previous & mask)) {
+			late &= ~mask;  // hit again, any velocity from here on is for the new hit
+		}
+
+		if (i == velocityPad && freshVelocity) {
+			if (late & mask) {
+				late &= ~mask;  // velocity for a hit that was already sent, drop it
+			}
+			else {
+				push(i, velocity, now);
+				latched |= mask;
+				pending &= ~mask;
+			}
+		}
+
+		if ((pressed & mask) && !(latched & mask) && !(pending & mask)) {
+			pending |= mask;  // new hit, wait for the velocity
+			hitTime[i] = (uint8_t) now;
+		}
+
+		if (pending & mask) {
+			if ((uint8_t) ((uint8_t) now - hitTime[i]) >= velocityWait) {
+				if (i == velocityPad) {
+					push(i, velocity, now);  // velocity report unchanged, same as the last hit
+				}
+				else {
+					push(i, 0, now);  // give up on the velocity
+					missedLast = true;
+					if (missed != 0xFFFF) missed++;
+				}
+				pending &= ~mask;
+				latched |= mask;
+				late |= mask;
+			}
+		}
+
+		const boolean fell = (previous & mask) && !(pressed & mask);
+		const boolean moved = !(pressed & mask) && i != velocityPad;
+		if (!(pending & mask) && (fell || moved)) {
+			latched &= ~mask;  // released, ready for the next hit
+		}
+	}
+
+	previous = pressed;
+}
+
+void DrumControllerBase::HitDecoder::reset() {
+	pending = latched = previous = late = 0;
+	lastPad = NumPads;
+	lastVelocity = 0;
+	queue.reset();
+	missedLast = false;
+	missed = 0;
+}
+
+uint8_t DrumControllerBase::HitDecoder::available() const {
+	return queue.available();
+}
+
+boolean DrumControllerBase::HitDecoder::read(Hit& hit) {
+	return queue.read(hit);
+}
+
+void DrumControllerBase::HitDecoder::setVelocityWait(uint8_t ms) {
+	velocityWait = ms;
+}
+
+uint8_t DrumControllerBase::HitDecoder::getVelocityWait() const {
+	return velocityWait;
+}
+
+boolean DrumControllerBase::HitDecoder::tooSlow() const {
+	return missedLast;
+}
+
+uint16_t DrumControllerBase::HitDecoder::getMissed() const {
+	return missed;
+}
+
+uint16_t DrumControllerBase::HitDecoder::getDropped() const {
+	return queue.getDropped();
+}
+
+void DrumControllerBase::HitDecoder::push(uint8_t pad, uint8_t velocity, unsigned long now) {
+	Hit hit;
+	hit.pad = PadIDs[pad];
+	hit.velocity = velocity;
+	hit.time = now;
+	queue.push(hit);  // dropped if full
+}
+
 void DrumControllerBase::printDebug(Print& output) const {
 	const char fillCharacter = '_';
 	
@@ -49,10 +49,18 @@ namespace NintendoExtensionCtrl {
 			constexpr static ByteMap Velocity = ByteMap(3, 3, 5, 5);
 			constexpr static ByteMap VelocityID = ByteMap(2, 5, 1, 1);
 			constexpr static BitMap  VelocityAvailable = { 2, 6 };
+
+			constexpr static BitMap  PackedButtons[8] = {  // Order of 'Buttons' bits
+				DrumRed, DrumBlue, DrumGreen,
+				CymbalYellow, CymbalOrange,
+				Pedal,
+				ButtonPlus, ButtonMinus };
 		};
 
 		using ExtensionController::ExtensionController;
 
+		static const uint8_t MaxRequestSize = MinRequestSize;  // Sizes the control data
+
 		ExtensionType getExpectedType() const;
 
 		enum VelocityID : uint8_t {
@@ -65,6 +73,32 @@ namespace NintendoExtensionCtrl {
 			Pedal = 0x1B,
 		};
 
+		struct Buttons {  // Bits for the packed button mask
+			enum : uint16_t {
+				DrumRed      = 1 << 0,
+				DrumBlue     = 1 << 1,
+				DrumGreen    = 1 << 2,
+
+				CymbalYellow = 1 << 3,
+				CymbalOrange = 1 << 4,
+
+				Pedal        = 1 << 5,
+
+				ButtonPlus   = 1 << 6,
+				ButtonMinus  = 1 << 7,
+			};
+		};
+
+		struct State {  // All controls, decoded at once
+			uint8_t joyX;
+			uint8_t joyY;
+
+			VelocityID velocityID;  // 'None' if no velocity data
+			uint8_t velocity;
+
+			uint8_t buttons;  // Packed, see 'Buttons'. '1' is pressed.
+		};
+
 		uint8_t joyX() const;  // 6 bits, 0-63
 		uint8_t joyY() const;
 
@@ -80,6 +114,8 @@ namespace NintendoExtensionCtrl {
 		boolean buttonPlus() const;
 		boolean buttonMinus() const;
 
+		uint16_t buttons() const;  // Packed, see 'Buttons'. '1' is pressed.
+
 		boolean velocityAvailable() const;
 		VelocityID velocityID() const;
 
@@ -93,8 +129,61 @@ namespace NintendoExtensionCtrl {
 		uint8_t velocityOrange() const;
 		uint8_t velocityPedal() const;
 
+		void decode(State& state) const;  // Decode all controls to a State struct
+
 		void printDebug(Print& output = NXC_SERIAL_DEFAULT) const;
 
+		class HitDecoder {  // Turns the pad and velocity data into a queue of hits
+		public:
+			struct Hit {
+				VelocityID pad;
+				uint8_t velocity;   // 1-7, or 0 if the velocity was missed
+				unsigned long time;  // millis() at the update that finished the hit
+			};
+
+			HitDecoder(const DrumControllerBase & controller) : drums(controller) {}
+
+			void update();  // Call once after each controller update
+			void reset();
+
+			uint8_t available() const;  // Number of hits waiting
+			boolean read(Hit& hit);  // Oldest hit, 'false' if none
+
+			void setVelocityWait(uint8_t ms);  // Time to wait for a velocity before giving up
+			uint8_t getVelocityWait() const;
+
+			boolean tooSlow() const;  // 'true' if a velocity was missed on the last update
+			uint16_t getMissed() const;  // Hits without a velocity
+			uint16_t getDropped() const;  // Hits lost to a full queue
+
+			static const uint8_t NumPads = 6;
+			static const uint8_t QueueSize = 8;
+			static const uint8_t DefaultVelocityWait = 10;
+
+			static const VelocityID PadIDs[NumPads];  // Same order as the 'Buttons' bits
+
+		private:
+			void push(uint8_t pad, uint8_t velocity, unsigned long now);
+
+			const DrumControllerBase & drums;
+
+			uint8_t pending = 0;  // Pads that were hit, waiting for a velocity (bitmask)
+			uint8_t latched = 0;  // Pads with a hit sent, waiting for them to be released (bitmask)
+			uint8_t previous = 0;  // Pad bits from the last update (bitmask)
+			uint8_t late = 0;  // Pads sent without a new velocity, so a late one is dropped (bitmask)
+			uint8_t hitTime[NumPads] = { 0 };  // Low byte of millis() when each pending pad was hit
+
+			uint8_t velocityWait = DefaultVelocityWait;
+
+			uint8_t lastPad = NumPads;  // Velocity report from the last update, to spot new ones
+			uint8_t lastVelocity = 0;
+
+			NintendoExtensionCtrl::EventQueue<Hit, QueueSize> queue;
+
+			boolean missedLast = false;
+			uint16_t missed = 0;
+		};
+
 	private:
 		boolean validVelocityID(uint8_t idIn) const;
 	};
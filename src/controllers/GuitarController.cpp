@@ -42,10 +42,40 @@ constexpr BitMap  GuitarControllerBase::Maps::FretOrange;
 constexpr ByteMap GuitarControllerBase::Maps::Whammy;
 constexpr ByteMap GuitarControllerBase::Maps::Touchbar;
 
+constexpr BitMap  GuitarControllerBase::Maps::PackedButtons[9];
+
+const uint8_t GuitarControllerBase::TouchbarFrets[32] PROGMEM = {
+	/* The touchbar reports one value for where it's touched, with values
+	 * between two frets counting for both. 15 is "not touched", and 31 is
+	 * what guitars without a touchbar report (all data bits '1'). The
+	 * table is kept in flash so it doesn't take up RAM on AVR.
+	 */
+	0,  // 0
+	Frets::Green, Frets::Green, Frets::Green,  // 1 - 3
+	Frets::Green, Frets::Green, Frets::Green,  // 4 - 6
+	Frets::Green | Frets::Red,  // 7
+	Frets::Red, Frets::Red, Frets::Red, Frets::Red,  // 8 - 11
+	Frets::Red | Frets::Yellow, Frets::Red | Frets::Yellow,  // 12 - 13
+	Frets::Yellow,  // 14
+	0,  // 15, not touched
+	Frets::Yellow, Frets::Yellow, Frets::Yellow, Frets::Yellow,  // 16 - 19
+	Frets::Yellow | Frets::Blue, Frets::Yellow | Frets::Blue,  // 20 - 21
+	Frets::Blue, Frets::Blue, Frets::Blue, Frets::Blue,  // 22 - 25
+	Frets::Blue | Frets::Orange,  // 26
+	Frets::Orange, Frets::Orange, Frets::Orange,  // 27 - 29
+	Frets::Orange, Frets::Orange,  // 30 - 31
+};
+
 ExtensionType GuitarControllerBase::getExpectedType() const {
 	return ExtensionType::GuitarController;
 }
 
+void GuitarControllerBase::specificUpdate() {
+	if (!touchbarData && touchbar() != 31) {  // '1' for all data bits
+		touchbarData = true;
+	}
+}
+
 uint8_t GuitarControllerBase::joyX() const {
 	return getControlData(Maps::JoyX);
 }
@@ -94,25 +124,28 @@ uint8_t GuitarControllerBase::touchbar() const {
 	return getControlData(Maps::Touchbar);
 }
 
+uint8_t GuitarControllerBase::touchFrets() const {
+	return pgm_read_byte(&TouchbarFrets[touchbar()]);
+}
+
 boolean GuitarControllerBase::touchGreen() const {
-	return touchbar() != 0 && touchbar() <= 7;
+	return touchFrets() & Frets::Green;
 }
 
 boolean GuitarControllerBase::touchRed() const {
-	return touchbar() >= 7 && touchbar() <= 13;
+	return touchFrets() & Frets::Red;
 }
 
 boolean GuitarControllerBase::touchYellow() const {
-	return touchbar() >= 12 && touchbar() <= 21
-		&& touchbar() != 15;	// The "not touched" value
+	return touchFrets() & Frets::Yellow;
 }
 
 boolean GuitarControllerBase::touchBlue() const {
-	return touchbar() >= 20 && touchbar() <= 26;
+	return touchFrets() & Frets::Blue;
 }
 
 boolean GuitarControllerBase::touchOrange() const {
-	return touchbar() >= 26;
+	return touchFrets() & Frets::Orange;
 }
 
 boolean GuitarControllerBase::buttonPlus() const {
@@ -123,14 +156,107 @@ boolean GuitarControllerBase::buttonMinus() const {
 	return getControlBit(Maps::ButtonMinus);
 }
 
-boolean GuitarControllerBase::supportsTouchbar() {
-	if (touchbarData) {
-		return true;
-	}
-	else if (touchbar() != 31) {  // '1' for all data bits
-		touchbarData = true;
+uint16_t GuitarControllerBase::buttons() const {
+	return getControlBits<Maps>();
+}
+
+void GuitarControllerBase::decode(State& state) const {
+	state.joyX = getControlData(Maps::JoyX);
+	state.joyY = getControlData(Maps::JoyY);
+
+	state.whammyBar = getControlData(Maps::Whammy);
+	state.touchbar = getControlData(Maps::Touchbar);
+
+	state.buttons = buttons();
+}
+
+boolean GuitarControllerBase::supportsTouchbar() const {
+	return touchbarData;
+}
+
+void GuitarControllerBase::StrumDecoder::update() {
+	/* The strum bar is a pair of switches, which on some guitars bounce for
+	 * a few milliseconds when they're hit or let go. The first change is
+	 * taken right away so there's no added latency, and then the strum bar
+	 * is ignored until the debounce time is up. The chord comes from the
+	 * same update as the strum, so frets pressed a moment later (like the
+	 * next chord) aren't counted.
+	 */
+	const unsigned long now = millis();
+	const uint16_t buttons = guitar.buttons();
+	const uint8_t strumBits = buttons & (Buttons::StrumUp | Buttons::StrumDown);
+
+	frets = (buttons / Buttons::FretGreen) & 0x1F;  // frets are packed together
+
+	const uint8_t whammyNow = guitar.whammyBar();
+	whammyDelta = primed ? (int8_t) (whammyNow - whammy) : 0;
+	whammy = whammyNow;
+	primed = true;
+
+	if (locked && now - lockTime < debounceTime) {
+		if (strumBits != strumRaw && bounces != 0xFFFF) bounces++;
+		strumRaw = strumBits;
+		return;
 	}
-	return false;
+	locked = false;
+	strumRaw = strumBits;
+
+	if (strumBits == strumState) return;
+
+	const uint8_t pressed = strumBits & ~strumState;
+	strumState = strumBits;
+	locked = true;
+	lockTime = now;
+
+	if (pressed == 0) return;  // released
+
+	Strum strum;
+	strum.chord = frets;
+	strum.direction = (pressed & Buttons::StrumUp) ? Direction::Up : Direction::Down;
+	strum.time = now;
+	queue.push(strum);  // dropped if full
+}
+
+void GuitarControllerBase::StrumDecoder::reset() {
+	strumState = strumRaw = 0;
+	locked = false;
+	frets = 0;
+	whammyDelta = 0;
+	primed = false;
+	queue.reset();
+	bounces = 0;
+}
+
+uint8_t GuitarControllerBase::StrumDecoder::available() const {
+	return queue.available();
+}
+
+boolean GuitarControllerBase::StrumDecoder::read(Strum& strum) {
+	return queue.read(strum);
+}
+
+uint8_t GuitarControllerBase::StrumDecoder::chord() const {
+	return frets;
+}
+
+int8_t GuitarControllerBase::StrumDecoder::whammyChange() const {
+	return whammyDelta;
+}
+
+void GuitarControllerBase::StrumDecoder::setDebounce(uint8_t ms) {
+	debounceTime = ms;
+}
+
+uint8_t GuitarControllerBase::StrumDecoder::getDebounce() const {
+	return debounceTime;
+}
+
+uint16_t GuitarControllerBase::StrumDecoder::getBounces() const {
+	return bounces;
+}
+
+uint16_t GuitarControllerBase::StrumDecoder::getDropped() const {
+	return queue.getDropped();
 }
 
 void GuitarControllerBase::printDebug(Print& output) {
@@ -165,11 +291,12 @@ void GuitarControllerBase::printDebug(Print& output) {
 
 	// Touchbar, if World Controller
 	if (supportsTouchbar()) {
-		const char greenPrint = touchGreen() ? 'G' : fillCharacter;
-		const char redPrint = touchRed() ? 'R' : fillCharacter;
-		const char yellowPrint = touchYellow() ? 'Y' : fillCharacter;
-		const char bluePrint = touchBlue() ? 'B' : fillCharacter;
-		const char orangePrint = touchOrange() ? 'O' : fillCharacter;
+		const uint8_t touch = touchFrets();
+		const char greenPrint = (touch & Frets::Green) ? 'G' : fillCharacter;
+		const char redPrint = (touch & Frets::Red) ? 'R' : fillCharacter;
+		const char yellowPrint = (touch & Frets::Yellow) ? 'Y' : fillCharacter;
+		const char bluePrint = (touch & Frets::Blue) ? 'B' : fillCharacter;
+		const char orangePrint = (touch & Frets::Orange) ? 'O' : fillCharacter;
 
 		snprintf(buffer, sizeof(buffer),
 			"Touch:%2u - %c%c%c%c%c | ",
@@ -48,10 +48,53 @@ namespace NintendoExtensionCtrl {
 
 			constexpr static ByteMap Whammy = ByteMap(3, 5, 0, 0);
 			constexpr static ByteMap Touchbar = ByteMap(2, 5, 0, 0);
+
+			constexpr static BitMap  PackedButtons[9] = {  // Order of 'Buttons' bits
+				StrumUp, StrumDown,
+				FretGreen, FretRed, FretYellow, FretBlue, FretOrange,
+				ButtonPlus, ButtonMinus };
+		};
+
+		struct Buttons {  // Bits for the packed button mask
+			enum : uint16_t {
+				StrumUp     = 1 << 0,
+				StrumDown   = 1 << 1,
+
+				FretGreen   = 1 << 2,
+				FretRed     = 1 << 3,
+				FretYellow  = 1 << 4,
+				FretBlue    = 1 << 5,
+				FretOrange  = 1 << 6,
+
+				ButtonPlus  = 1 << 7,
+				ButtonMinus = 1 << 8,
+			};
+		};
+
+		struct Frets {  // Bits for the packed fret masks, e.g. 'touchFrets()'
+			enum : uint8_t {
+				Green  = 1 << 0,
+				Red    = 1 << 1,
+				Yellow = 1 << 2,
+				Blue   = 1 << 3,
+				Orange = 1 << 4,
+			};
+		};
+
+		struct State {  // All controls, decoded at once
+			uint8_t joyX;
+			uint8_t joyY;
+
+			uint8_t whammyBar;
+			uint8_t touchbar;
+
+			uint16_t buttons;  // Packed, see 'Buttons'. '1' is pressed.
 		};
 
 		using ExtensionController::ExtensionController;
 
+		static const uint8_t MaxRequestSize = MinRequestSize;  // Sizes the control data
+
 		ExtensionType getExpectedType() const;
 
 		uint8_t joyX() const;  // 6 bits, 0-63
@@ -70,6 +113,7 @@ namespace NintendoExtensionCtrl {
 		uint8_t whammyBar() const;  // 5 bits, 0-31 (starting at ~15-16)
 
 		uint8_t touchbar() const;  // 5 bits, 0-31
+		uint8_t touchFrets() const;  // Packed, see 'Frets'. Touches can span two frets.
 		boolean touchGreen() const;
 		boolean touchRed() const;
 		boolean touchYellow() const;
@@ -79,11 +123,72 @@ namespace NintendoExtensionCtrl {
 		boolean buttonPlus() const;
 		boolean buttonMinus() const;
 
+		uint16_t buttons() const;  // Packed, see 'Buttons'. '1' is pressed.
+
+		void decode(State& state) const;  // Decode all controls to a State struct
+
 		void printDebug(Print& output = NXC_SERIAL_DEFAULT);
 
-		boolean supportsTouchbar();
+		boolean supportsTouchbar() const;  // 'true' once touchbar data has been seen
+
+		class StrumDecoder {  // Debounced strums, each with the frets held at the time
+		public:
+			enum class Direction : uint8_t {
+				Up,
+				Down,
+			};
+
+			struct Strum {
+				uint8_t chord;  // Frets held, packed, see 'Frets'
+				Direction direction;
+				unsigned long time;  // millis() at the update with the strum
+			};
+
+			StrumDecoder(const GuitarControllerBase & controller) : guitar(controller) {}
+
+			void update();  // Call once after each controller update
+			void reset();
+
+			uint8_t available() const;  // Number of strums waiting
+			boolean read(Strum& strum);  // Oldest strum, 'false' if none
+
+			uint8_t chord() const;  // Frets held on the last update
+			int8_t whammyChange() const;  // Whammy bar movement since the previous update
+
+			void setDebounce(uint8_t ms);  // Time the strum bar is ignored after a change
+			uint8_t getDebounce() const;
+
+			uint16_t getBounces() const;  // Strum bar changes ignored by the debounce
+			uint16_t getDropped() const;  // Strums lost to a full queue
+
+			static const uint8_t QueueSize = 8;
+			static const uint8_t DefaultDebounce = 15;
+
+		private:
+			const GuitarControllerBase & guitar;
+
+			uint8_t debounceTime = DefaultDebounce;
+			uint8_t strumState = 0;  // Debounced 'Buttons' strum bits
+			uint8_t strumRaw = 0;    // Strum bits from the last update
+			boolean locked = false;  // Ignoring the strum bar until the debounce is over
+			unsigned long lockTime = 0;
+
+			uint8_t frets = 0;
+			uint8_t whammy = 0;
+			int8_t whammyDelta = 0;
+			boolean primed = false;  // Whammy movement starts from the first update
+
+			NintendoExtensionCtrl::EventQueue<Strum, QueueSize> queue;
+
+			uint16_t bounces = 0;
+		};
+
+	protected:
+		void specificUpdate();  // watches the data for touchbar support
 
 	private:
+		static const uint8_t TouchbarFrets[32];  // Touchbar value to fret mask, in PROGMEM
+
 		boolean touchbarData = false;  // Flag for touchbar data found
 	};
 }
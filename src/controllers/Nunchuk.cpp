@@ -39,6 +39,18 @@ constexpr ByteMap  NunchukBase::Maps::AccelZ_LSB;
 constexpr BitMap   NunchukBase::Maps::ButtonC;
 constexpr BitMap   NunchukBase::Maps::ButtonZ;
 
+constexpr BitMap   NunchukBase::Maps::PackedButtons[2];
+
+boolean NunchukBase::specificInit() {
+	resetCalibration();  // don't keep the calibration for a different controller
+
+	if (calibrateOnConnect) {
+		delayMicroseconds(I2C_ConversionDelay);  // wait after ID read before reading again
+		readCalibration();  // use the defaults if the calibration is bad
+	}
+	return true;
+}
+
 ExtensionType NunchukBase::getExpectedType() const {
 	return ExtensionType::Nunchuk;
 }
@@ -63,6 +75,82 @@ uint16_t NunchukBase::accelZ() const {
 	return (getControlData(Maps::AccelZ_MSB) << 2) | getControlData(Maps::AccelZ_LSB);
 }
 
+int16_t NunchukBase::gForceX() const {
+	return gForce(accelX(), 0);
+}
+
+int16_t NunchukBase::gForceY() const {
+	return gForce(accelY(), 1);
+}
+
+int16_t NunchukBase::gForceZ() const {
+	return gForce(accelZ(), 2);
+}
+
+boolean NunchukBase::readCalibration() {
+	uint8_t block[CalibrationSize];
+	if (!requestData(CalibrationPtr, CalibrationSize, block)) return false;
+	return setCalibration(block);
+}
+
+void NunchukBase::setCalibrationOnConnect(boolean enable) {
+	calibrateOnConnect = enable;
+}
+
+boolean NunchukBase::calibrated() const {
+	return hasCalibration;
+}
+
+void NunchukBase::resetCalibration() {
+	for (uint8_t i = 0; i < 3; i++) {
+		zeroG[i] = DefaultZero;
+		gScale[i] = (1000UL << ScaleShift) / DefaultSpan;
+	}
+	hasCalibration = false;
+}
+
+boolean NunchukBase::setCalibration(const uint8_t* block) {
+	/* Nunchuk calibration block, 16 bytes from 0x20:
+	 *     0-2   Zero-g point, X / Y / Z <9:2>
+	 *     3     Zero-g point LSBs, same layout as byte 5 of the control data
+	 *     4-6   1 g point, X / Y / Z <9:2>
+	 *     7     1 g point LSBs
+	 *     8-13  Joystick X and Y max / min / center
+	 *     14-15 Checksum, sum of 0-13 plus 0x55 and plus 0xAA
+	 *
+	 * Plenty of knockoffs fill this with junk, so it's only used if the
+	 * checksum matches and each axis has a sensible span. The division for
+	 * the g scale is done here, once, so the 'gForce' functions are just a
+	 * multiply and a shift.
+	 */
+	uint8_t sum = 0;
+	for (uint8_t i = 0; i < 14; i++) {
+		sum += block[i];
+	}
+	if (block[14] != (uint8_t) (sum + 0x55) || block[15] != (uint8_t) (sum + 0xAA)) return false;
+
+	uint16_t zero[3], one[3];
+	for (uint8_t i = 0; i < 3; i++) {
+		const uint8_t lsbShift = 2 + (i * 2);  // X <3:2>, Y <5:4>, Z <7:6>
+		zero[i] = (block[i] << 2) | ((block[3] >> lsbShift) & 0x03);
+		one[i] = (block[4 + i] << 2) | ((block[7] >> lsbShift) & 0x03);
+
+		if (one[i] < zero[i] + MinSpan) return false;  // backwards or too small, junk
+	}
+
+	for (uint8_t i = 0; i < 3; i++) {
+		zeroG[i] = zero[i];
+		gScale[i] = (1000UL << ScaleShift) / (one[i] - zero[i]);
+	}
+	hasCalibration = true;
+
+	return true;
+}
+
+int16_t NunchukBase::gForce(uint16_t accel, uint8_t axis) const {
+	return ((int32_t) accel - zeroG[axis]) * gScale[axis] >> ScaleShift;
+}
+
 boolean NunchukBase::buttonC() const {
 	return getControlBit(Maps::ButtonC);
 }
@@ -71,6 +159,23 @@ boolean NunchukBase::buttonZ() const {
 	return getControlBit(Maps::ButtonZ);
 }
 
+uint16_t NunchukBase::buttons() const {
+	return getControlBits<Maps>();
+}
+
+void NunchukBase::decode(State& state) const {
+	const uint8_t lsb = getControlData(5);  // LSBs for all three accelerometer axes
+
+	state.joyX = getControlData(Maps::JoyX);
+	state.joyY = getControlData(Maps::JoyY);
+
+	state.accelX = (getControlData(Maps::AccelX_MSB) << 2) | ((lsb & Maps::AccelX_LSB.mask) >> Maps::AccelX_LSB.offset);
+	state.accelY = (getControlData(Maps::AccelY_MSB) << 2) | ((lsb & Maps::AccelY_LSB.mask) >> Maps::AccelY_LSB.offset);
+	state.accelZ = (getControlData(Maps::AccelZ_MSB) << 2) | ((lsb & Maps::AccelZ_LSB.mask) >> Maps::AccelZ_LSB.offset);
+
+	state.buttons = buttons();
+}
+
 float NunchukBase::rollAngle() const {
 	return atan2((float)accelX() - 511.0, (float)accelZ() - 511.0) * 180.0 / PI;
 }
@@ -80,6 +185,31 @@ float NunchukBase::pitchAngle() const {
 	return -atan2((float)accelY() - 511.0, (float)accelZ() - 511.0) * 180.0 / PI;
 }
 
+int16_t NunchukBase::rollAngleCenti() const {
+	return atan2Centi((int16_t) accelX() - 511, (int16_t) accelZ() - 511);
+}
+
+int16_t NunchukBase::pitchAngleCenti() const {
+	// Inverted so pulling back is a positive pitch
+	return -atan2Centi((int16_t) accelY() - 511, (int16_t) accelZ() - 511);
+}
+
+float NunchukBase::rollAngleCalibrated() const {
+	return atan2((float)gForceX(), (float)gForceZ()) * 180.0 / PI;
+}
+
+float NunchukBase::pitchAngleCalibrated() const {
+	return -atan2((float)gForceY(), (float)gForceZ()) * 180.0 / PI;
+}
+
+int16_t NunchukBase::rollAngleCentiCalibrated() const {
+	return atan2Centi(gForceX(), gForceZ());
+}
+
+int16_t NunchukBase::pitchAngleCentiCalibrated() const {
+	return -atan2Centi(gForceY(), gForceZ());
+}
+
 void NunchukBase::printDebug(Print& output) const {
 	// 59 characters, 1 terminating null, and 7 extra so the compiler stops
 	// complaining about not having enough buffer space for the full 16 bit
@@ -97,4 +227,142 @@ void NunchukBase::printDebug(Print& output) const {
 	output.println(buffer);
 }
 
+NunchukMotion::NunchukMotion(const NunchukBase& controller) :
+	nchuk(controller) {}
+
+void NunchukMotion::update() {
+	/* Each update splits the acceleration into 'gravity', a slow moving
+	 * low-pass average that gives the Nunchuk's orientation, and 'motion',
+	 * whatever is left over after gravity is removed. Shaking is measured
+	 * separately as the variance of the acceleration over the last few
+	 * updates. Everything is a fixed amount of integer work per update:
+	 * no buffers to scan and no floating point.
+	 */
+	const int16_t g[3] = { nchuk.gForceX(), nchuk.gForceY(), nchuk.gForceZ() };
+
+	if (!primed) {  // start at rest, rather than ramping up from zero
+		for (uint8_t i = 0; i < 3; i++) gravity[i].reset(g[i]);
+		primed = true;
+	}
+
+	uint32_t sum = 0;  // three axes can add past 16 bits
+	for (uint8_t i = 0; i < 3; i++) {
+		motion[i] = g[i] - gravity[i].update(g[i]);
+		sum += (uint16_t) abs(motion[i]);
+		stats[i].add(constrain(g[i], -0x3FFF, 0x3FFF));  // limit for the variance sums
+	}
+	energy = (sum > 0xFFFF) ? 0xFFFF : sum;
+
+	detectSwing();
+	detectTilt();
+}
+
+void NunchukMotion::reset() {
+	for (uint8_t i = 0; i < 3; i++) {
+		stats[i].reset();
+		motion[i] = 0;
+	}
+	energy = 0;
+	primed = false;
+	swingArmed = true;
+	lastSwing = Swing::None;
+	tiltCandidate = Tilt::None;
+	tiltCount = 0;
+}
+
+void NunchukMotion::detectSwing() {
+	// Find the axis with the strongest motion
+	uint8_t axis = 0;
+	for (uint8_t i = 1; i < 3; i++) {
+		if (abs(motion[i]) > abs(motion[axis])) axis = i;
+	}
+	const uint16_t strength = abs(motion[axis]);
+
+	lastSwing = Swing::None;
+	if (swingArmed && strength >= swingThreshold) {
+		// Swing enum pairs are in axis order, negative then positive
+		lastSwing = static_cast<Swing>(1 + (axis * 2) + (motion[axis] > 0));
+		swingArmed = false;  // one event per swing
+	}
+	else if (!swingArmed && strength < swingThreshold / 2) {
+		swingArmed = true;  // settled down, ready for the next one
+	}
+}
+
+void NunchukMotion::detectTilt() {
+	const int16_t roll = atan2Centi(gravity[0].value(), gravity[2].value());
+	const int16_t pitch = -atan2Centi(gravity[1].value(), gravity[2].value());  // pulling back is positive
+
+	Tilt current = Tilt::None;
+	if (abs(roll) >= abs(pitch)) {
+		if (roll >= tiltThreshold) current = Tilt::Right;
+		else if (roll <= -tiltThreshold) current = Tilt::Left;
+	}
+	else {
+		if (pitch >= tiltThreshold) current = Tilt::Back;
+		else if (pitch <= -tiltThreshold) current = Tilt::Forward;
+	}
+
+	if (current != tiltCandidate) {
+		tiltCandidate = current;
+		tiltCount = 0;
+	}
+	if (tiltCount < tiltHold) tiltCount++;
+}
+
+int16_t NunchukMotion::gravityX() const {
+	return gravity[0].value();
+}
+
+int16_t NunchukMotion::gravityY() const {
+	return gravity[1].value();
+}
+
+int16_t NunchukMotion::gravityZ() const {
+	return gravity[2].value();
+}
+
+int16_t NunchukMotion::motionX() const {
+	return motion[0];
+}
+
+int16_t NunchukMotion::motionY() const {
+	return motion[1];
+}
+
+int16_t NunchukMotion::motionZ() const {
+	return motion[2];
+}
+
+uint16_t NunchukMotion::motionEnergy() const {
+	return energy;
+}
+
+boolean NunchukMotion::shaking() const {
+	const uint32_t variance = stats[0].variance() + stats[1].variance() + stats[2].variance();
+	return variance >= (uint32_t) shakeThreshold * shakeThreshold;  // compare squared, no sqrt
+}
+
+NunchukMotion::Swing NunchukMotion::swing() const {
+	return lastSwing;
+}
+
+NunchukMotion::Tilt NunchukMotion::tilt() const {
+	return (tiltCount >= tiltHold) ? tiltCandidate : Tilt::None;
+}
+
+void NunchukMotion::setShakeThreshold(uint16_t mg) {
+	shakeThreshold = mg;
+}
+
+void NunchukMotion::setSwingThreshold(uint16_t mg) {
+	swingThreshold = mg;
+}
+
+void NunchukMotion::setTiltThreshold(int16_t centiDegrees, uint8_t holdUpdates) {
+	tiltThreshold = centiDegrees;
+	tiltHold = holdUpdates;
+	tiltCount = 0;
+}
+
 }  // End "NintendoExtensionCtrl" namespace
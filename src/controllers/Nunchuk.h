@@ -43,12 +43,40 @@ namespace NintendoExtensionCtrl {
 
 			constexpr static BitMap   ButtonC = { 5, 1 };
 			constexpr static BitMap   ButtonZ = { 5, 0 };
+
+			constexpr static BitMap   PackedButtons[2] = { ButtonC, ButtonZ };  // Order of 'Buttons' bits
+		};
+
+		struct Buttons {  // Bits for the packed button mask
+			enum : uint8_t {
+				ButtonC = 1 << 0,
+				ButtonZ = 1 << 1,
+			};
+		};
+
+		struct State {  // All controls, decoded at once
+			uint8_t joyX;
+			uint8_t joyY;
+
+			uint16_t accelX;
+			uint16_t accelY;
+			uint16_t accelZ;
+
+			uint8_t buttons;  // Packed, see 'Buttons'. '1' is pressed.
 		};
 		
 		using ExtensionController::ExtensionController;
 
+		static const uint8_t MaxRequestSize = MinRequestSize;  // Sizes the control data
+
+		boolean specificInit();
+
 		ExtensionType getExpectedType() const;
 
+		boolean readCalibration();  // Read the controller's calibration. 'false' if bad, keeps the defaults
+		void setCalibrationOnConnect(boolean enable = true);  // Read the calibration every time on connect
+		boolean calibrated() const;  // 'true' if using the controller's calibration
+
 		uint8_t joyX() const;  // 8 bits, 0-255
 		uint8_t joyY() const;
 
@@ -56,17 +84,128 @@ namespace NintendoExtensionCtrl {
 		uint16_t accelY() const;
 		uint16_t accelZ() const;
 
+		int16_t gForceX() const;  // milli-g, calibrated
+		int16_t gForceY() const;
+		int16_t gForceZ() const;
+
 		boolean buttonC() const;
 		boolean buttonZ() const;
 
+		uint16_t buttons() const;  // Packed, see 'Buttons'. '1' is pressed.
+
+		void decode(State& state) const;  // Decode all controls to a State struct
+
 		float rollAngle() const;  // -180.0 to 180.0
 		float pitchAngle() const;
 
+		int16_t rollAngleCenti() const;  // -18000 to 18000, centi-degrees. No floating point.
+		int16_t pitchAngleCenti() const;
+
+		float rollAngleCalibrated() const;  // Same as above, from the calibrated 'gForce' values
+		float pitchAngleCalibrated() const;
+
+		int16_t rollAngleCentiCalibrated() const;
+		int16_t pitchAngleCentiCalibrated() const;
+
 		void printDebug(Print& output = NXC_SERIAL_DEFAULT) const;
+
+		static const uint8_t CalibrationPtr = 0x20;   // Start of the calibration block
+		static const uint8_t CalibrationSize = 16;
+
+	private:
+		void resetCalibration();
+		boolean setCalibration(const uint8_t* block);  // 'false' if the block is bad
+		int16_t gForce(uint16_t accel, uint8_t axis) const;
+
+		static const uint16_t DefaultZero = 511;  // Uncalibrated zero-g point
+		static const uint16_t DefaultSpan = 204;  // Uncalibrated 1 g, above zero
+		static const uint16_t MinSpan = 64;       // Smallest 1 g span accepted, so milli-g fits in 16 bits
+		static const uint8_t  ScaleShift = 10;    // Fixed point shift for the g scale factors
+
+		boolean calibrateOnConnect = false;
+		boolean hasCalibration = false;
+
+		uint16_t zeroG[3] = { DefaultZero, DefaultZero, DefaultZero };  // Zero-g points per axis, 10 bits
+		uint16_t gScale[3] = {  // milli-g per count, << ScaleShift
+			(1000UL << ScaleShift) / DefaultSpan,
+			(1000UL << ScaleShift) / DefaultSpan,
+			(1000UL << ScaleShift) / DefaultSpan,
+		};
+	};
+
+	class NunchukMotion {  // Filtering and gesture detection for the accelerometer
+	public:
+		enum class Swing : uint8_t {  // Along the Nunchuk's axes
+			None,
+			Left,     // -X
+			Right,    // +X
+			Back,     // -Y
+			Forward,  // +Y
+			Down,     // -Z
+			Up,       // +Z
+		};
+
+		enum class Tilt : uint8_t {
+			None,
+			Left,     // Roll
+			Right,
+			Forward,  // Pitch
+			Back,
+		};
+
+		NunchukMotion(const NunchukBase& controller);
+
+		void update();  // Call once after each controller update
+		void reset();
+
+		int16_t gravityX() const;  // milli-g, low-pass
+		int16_t gravityY() const;
+		int16_t gravityZ() const;
+
+		int16_t motionX() const;  // milli-g, high-pass (gravity removed)
+		int16_t motionY() const;
+		int16_t motionZ() const;
+
+		uint16_t motionEnergy() const;  // milli-g, sum of all axes. Saturates at 65535
+
+		boolean shaking() const;  // 'true' while the acceleration is varying strongly
+		Swing swing() const;      // Swing that started this update, if any
+		Tilt tilt() const;        // Tilt held past the threshold, if any
+
+		void setShakeThreshold(uint16_t mg);  // Standard deviation, all axes combined
+		void setSwingThreshold(uint16_t mg);  // Motion on one axis
+		void setTiltThreshold(int16_t centiDegrees, uint8_t holdUpdates);
+
+		static const uint8_t GravityShift = 3;  // Low-pass smoothing, 1/8 per update
+		static const uint8_t Window = 8;        // Updates for the shake variance
+
+	private:
+		void detectSwing();
+		void detectTilt();
+
+		const NunchukBase& nchuk;
+
+		ExponentialFilter gravity[3] = { GravityShift, GravityShift, GravityShift };
+		int16_t motion[3] = { 0 };
+		uint16_t energy = 0;
+		RunningVariance<Window> stats[3];
+
+		uint16_t shakeThreshold = 300;
+		uint16_t swingThreshold = 800;
+		int16_t  tiltThreshold = 3000;
+		uint8_t  tiltHold = 10;
+
+		boolean primed = false;      // Filters are set from the first update
+		boolean swingArmed = true;   // Motion has dropped since the last swing
+		Swing lastSwing = Swing::None;
+		Tilt tiltCandidate = Tilt::None;
+		uint8_t tiltCount = 0;       // Updates the candidate tilt has been held
 	};
 }
 
 using Nunchuk = NintendoExtensionCtrl::BuildControllerClass
 	<NintendoExtensionCtrl::NunchukBase>;
 
+using NunchukMotion = NintendoExtensionCtrl::NunchukMotion;
+
 #endif
@@ -35,6 +35,8 @@ constexpr BitMap   uDrawTabletBase::Maps::Pressure_MSB;
 constexpr BitMap   uDrawTabletBase::Maps::ButtonLower;
 constexpr BitMap   uDrawTabletBase::Maps::ButtonUpper;
 
+constexpr BitMap   uDrawTabletBase::Maps::PackedButtons[2];
+
 ExtensionType uDrawTabletBase::getExpectedType() const {
 	return ExtensionType::uDrawTablet;
 }
@@ -59,10 +61,24 @@ boolean uDrawTabletBase::buttonUpper() const {
 	return getControlBit(Maps::ButtonUpper);
 }
 
+uint16_t uDrawTabletBase::buttons() const {
+	return getControlBits<Maps>();
+}
+
 boolean uDrawTabletBase::penDetected() const {
 	return penX() < 4095 && penY() < 4095;
 }
 
+void uDrawTabletBase::decode(State& state) const {
+	state.penX = (getControlData(Maps::PenX_MSB) << 8) | getControlData(Maps::PenX_LSB);
+	state.penY = (getControlData(Maps::PenY_MSB) << 8) | getControlData(Maps::PenY_LSB);
+	state.penPressure = (!getControlBit(Maps::Pressure_MSB) << 8) | getControlData(Maps::Pressure_LSB);
+
+	state.penDetected = state.penX < 4095 && state.penY < 4095;
+
+	state.buttons = buttons();
+}
+
 void uDrawTabletBase::printDebug(Print& output) const {
 	// 59 characters, 1 terminating null, and 4 extra so the compiler stops
 	// complaining about not having enough buffer space for the full 16 bit
@@ -81,4 +97,9 @@ void uDrawTabletBase::printDebug(Print& output) const {
 	output.println(buffer);
 }
 
+void uDrawTabletBase::StrokeRecorder::update() {
+	const boolean down = tablet.penDetected() && tablet.penPressure() > pressureThreshold;
+	addSample(tablet.penX(), tablet.penY(), down);
+}
+
 }  // End "NintendoExtensionCtrl" namespace
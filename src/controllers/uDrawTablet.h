@@ -24,6 +24,7 @@
 #define NXC_UDRAWTABLET_H
 
 #include "internal/ExtensionController.h"
+#include "internal/NXC_Strokes.h"
 
 namespace NintendoExtensionCtrl {
 	class uDrawTabletBase : public ExtensionController {
@@ -39,10 +40,33 @@ namespace NintendoExtensionCtrl {
 			constexpr static BitMap   Pressure_MSB = { 5, 2 };
 			constexpr static BitMap   ButtonLower = { 5, 1 };
 			constexpr static BitMap   ButtonUpper = { 5, 0 };
+
+			constexpr static BitMap   PackedButtons[2] = { ButtonLower, ButtonUpper };  // Order of 'Buttons' bits
+		};
+
+		struct Buttons {  // Bits for the packed button mask
+			enum : uint8_t {
+				ButtonLower = 1 << 0,
+				ButtonUpper = 1 << 1,
+			};
+		};
+
+		struct State {  // All controls, decoded at once
+			uint16_t penX;
+			uint16_t penY;
+			uint16_t penPressure;
+
+			boolean penDetected;
+
+			uint8_t buttons;  // Packed, see 'Buttons'. '1' is pressed.
 		};
 		
 		using ExtensionController::ExtensionController;
 
+		static const uint8_t MaxRequestSize = MinRequestSize;  // Sizes the control data
+
+		static const uint16_t PenMax = 4095;  // Largest 'penX()' / 'penY()' value
+
 		ExtensionType getExpectedType() const;
 
 		uint16_t penX() const;  // 12 bits, 0-4095
@@ -52,10 +76,27 @@ namespace NintendoExtensionCtrl {
 
 		boolean  buttonLower() const;
 		boolean  buttonUpper() const;
+
+		uint16_t buttons() const;  // Packed, see 'Buttons'. '1' is pressed.
 		
 		boolean  penDetected() const;
 
+		void decode(State& state) const;  // Decode all controls to a State struct
+
 		void printDebug(Print& output = NXC_SERIAL_DEFAULT) const;
+
+		class StrokeRecorder : public StrokeRecorderBase {  // Simplified pen strokes, see 'StrokeRecorderBase'
+		public:
+			StrokeRecorder(const uDrawTabletBase & controller)
+				: StrokeRecorderBase(DefaultTolerance), tablet(controller) {}
+
+			void update();  // Call once after each controller update
+
+			static const uint8_t DefaultTolerance = 4;
+
+		private:
+			const uDrawTabletBase & tablet;
+		};
 	};
 }
 
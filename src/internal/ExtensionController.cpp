@@ -27,6 +27,10 @@ namespace NintendoExtensionCtrl {
 ExtensionController::ExtensionController(ExtensionData& dataRef)
 	: data(dataRef)  {}
 
+ExtensionController::~ExtensionController() {
+	if (data.active == this) data.active = nullptr;  // don't leave the shared data pointing at us
+}
+
 void ExtensionController::begin() {
 	data.i2c.begin();  // Initialize the bus
 }
@@ -34,17 +38,25 @@ void ExtensionController::begin() {
 boolean ExtensionController::connect() {
 	boolean success = false;  // assume no connection
 
+	// Forget the multiplexer's cached channel so it's always re-selected on
+	// connection, in case the mux was reset or switched by someone else
+	if (data.mux != nullptr) data.mux->invalidate();
+
+	data.active = nullptr;  // nothing connected until the init succeeds
+
 	if (initialize()) {
 		identifyController();  // poll controller for its identity
 
 		if (controllerTypeMatches()) {  // if the right controller is connected...
-			memset(&data.controlData, 0x00, ExtensionData::ControlDataSize);  // clear control data
+			memset(data.controlData, 0x00, data.controlDataSize);  // clear control data
 			data.requestSize = MinRequestSize;  // request size back to minimum
 			success = specificInit();  // connect success dependent on controller-specific init
+			if (success) data.active = this;
 		}
 	}
 	else {
 		data.connectedType = ExtensionType::NoController;
+		data.connectedSubtype = 0x00;
 	}
 
 	return success;
@@ -54,9 +66,19 @@ boolean ExtensionController::specificInit() {
 	return true;  // default 'success' (no controller-specific init) for generic controllers
 }
 
+void ExtensionController::specificUpdate() {
+	// nothing to do for generic controllers
+}
+
+void ExtensionController::setActive(ExtensionController& controller) {
+	data.active = &controller;
+}
+
 void ExtensionController::reset() {
 	data.connectedType = ExtensionType::NoController;  // Nothing connected
-	memset(&data.controlData, 0x00, ExtensionData::ControlDataSize);  // Clear control data
+	data.connectedSubtype = 0x00;
+	data.active = nullptr;
+	memset(data.controlData, 0x00, data.controlDataSize);  // Clear control data
 	data.requestSize = MinRequestSize;  // Request size back to minimum
 }
 
@@ -81,18 +103,21 @@ ExtensionType ExtensionController::getControllerType() const {
 	return data.connectedType;
 }
 
+uint8_t ExtensionController::getControllerSubtype() const {
+	return data.connectedSubtype;
+}
+
 boolean ExtensionController::update() {
-	if (controllerTypeMatches() && requestControlData(data.requestSize, data.controlData)) {
-		return verifyData(data.controlData, data.requestSize);
+	if (controllerTypeMatches() && requestControlData(data.requestSize, data.controlData)
+		&& verifyData(data.controlData, data.requestSize))
+	{
+		if (data.active != nullptr) data.active->specificUpdate();  // controller-specific handling of the new data
+		return true;
 	}
 	
 	return false;  // Something went wrong :(
 }
 
-uint8_t ExtensionController::getControlData(uint8_t controlIndex) const {
-	return data.controlData[controlIndex];
-}
-
 void ExtensionController::setControlData(uint8_t index, uint8_t val) {
 	data.controlData[index] = val;
 }
@@ -105,16 +130,30 @@ size_t ExtensionController::getRequestSize() const {
 	return data.requestSize;
 }
 
-void ExtensionController::setRequestSize(size_t r) {
-	if (r >= MinRequestSize && r <= MaxRequestSize) {
+boolean ExtensionController::setRequestSize(size_t r) {
+	if (r >= MinRequestSize && r <= data.controlDataSize) {  // no larger than the data buffer
 		data.requestSize = (uint8_t) r;
+		return true;
 	}
+	return false;  // size unchanged
 }
 
 NXC_I2C_TYPE & ExtensionController::i2c() const {
 	return data.i2c;
 }
 
+I2CMultiplexer * ExtensionController::getMultiplexer() const {
+	return data.mux;
+}
+
+uint8_t ExtensionController::getMultiplexerChannel() const {
+	return data.muxChannel;
+}
+
+boolean ExtensionController::channelSelected() const {
+	return data.mux == nullptr || data.mux->getChannel() == data.muxChannel;
+}
+
 void ExtensionController::printDebug(Print& output) const {
 	printDebugRaw(output);
 }
@@ -191,6 +230,18 @@ ExtensionType ExtensionController::identifyController(NXC_I2C_TYPE& i2c) {
 	return decodeIdentity(idData);
 }
 
+ExtensionType ExtensionController::identifyController() const {
+	uint8_t idData[ID_Size];
+
+	if (!selectChannel() || !requestIdentity(data.i2c, idData)) {
+		data.connectedSubtype = 0x00;
+		return data.connectedType = ExtensionType::NoController;
+	}
+
+	data.connectedSubtype = idData[0];  // kept for controllers with per-model quirks
+	return data.connectedType = decodeIdentity(idData);
+}
+
 // port-specific connect function that utilizes the linked list to evaluate
 // each attached controller variant automatically
 boolean ExtensionPort::connect() {
@@ -214,7 +265,10 @@ boolean ExtensionPort::connect() {
 
 		if (controller.controllerTypeMatches()) {
 			success = controller.specificInit();
-			if (success) break;
+			if (success) {
+				setActive(controller);  // this variant gets the update calls
+				break;
+			}
 		}
 		ptr = ptr->getNext();
 	}
@@ -28,6 +28,7 @@
 #include "NXC_Utils.h"
 #include "NXC_DataMaps.h"
 #include "NXC_LinkedList.h"
+#include "NXC_Multiplexer.h"
 
 
 namespace NintendoExtensionCtrl {
@@ -37,19 +38,61 @@ namespace NintendoExtensionCtrl {
 		struct ExtensionData {
 			friend class ExtensionController;
 
-			ExtensionData(NXC_I2C_TYPE& i2cbus) :
-				i2c(i2cbus) {}
+			ExtensionData(NXC_I2C_TYPE& i2cbus, uint8_t * buffer, uint8_t size) :
+				i2c(i2cbus), controlData(buffer), controlDataSize(size) {}
+
+			ExtensionData(I2CMultiplexer& mux, uint8_t channel, uint8_t * buffer, uint8_t size) :
+				i2c(mux.i2c()), mux(&mux), muxChannel(channel), controlData(buffer), controlDataSize(size) {}
+
+			ExtensionData(const ExtensionData&) = delete;  // would share the buffer, see 'ExtensionDataOf'
 
 			static const uint8_t ControlDataSize = 21;  // Largest reporting mode (0x3d)
 
+		protected:
+			// Copies the connection state onto a new buffer. The copy isn't
+			// tied to a controller until one connects with it.
+			ExtensionData(const ExtensionData& other, uint8_t * buffer) :
+				i2c(other.i2c), mux(other.mux), muxChannel(other.muxChannel),
+				connectedType(other.connectedType), connectedSubtype(other.connectedSubtype),
+				requestSize(other.requestSize), controlData(buffer), controlDataSize(other.controlDataSize) {}
+
 		private:
 			NXC_I2C_TYPE & i2c;  // Reference for the I2C (Wire) class
+			I2CMultiplexer * const mux = nullptr;  // Multiplexer the controller is behind, if any
+			const uint8_t muxChannel = 0;
 			ExtensionType connectedType = ExtensionType::NoController;
+			uint8_t connectedSubtype = 0x00;  // ID byte 0, tells apart models of the same type
 			uint8_t requestSize = MinRequestSize;
-			uint8_t controlData[ControlDataSize];
+			uint8_t * const controlData;  // Buffer from 'ExtensionDataOf'
+			const uint8_t controlDataSize;
+			ExtensionController * active = nullptr;  // Controller that connected, gets 'specificUpdate()'
+		};
+
+		// Data instance with its own control data buffer. The buffer only needs
+		// to be as large as the largest request the controller makes, so most
+		// controllers get by with 6 bytes rather than the full 21.
+		template <uint8_t Size>
+		struct ExtensionDataOf : public ExtensionData {
+			static_assert(Size >= 6 && Size <= ControlDataSize, "Control data size must be 6-21 bytes");
+
+			ExtensionDataOf(NXC_I2C_TYPE& i2cbus) :
+				ExtensionData(i2cbus, buffer, Size) {}
+
+			ExtensionDataOf(I2CMultiplexer& mux, uint8_t channel) :
+				ExtensionData(mux, channel, buffer, Size) {}
+
+			ExtensionDataOf(const ExtensionDataOf& other) :
+				ExtensionData(other, buffer)
+			{
+				for (uint8_t i = 0; i < Size; i++) buffer[i] = other.buffer[i];
+			}
+
+		private:
+			uint8_t buffer[Size];
 		};
 
 		ExtensionController(ExtensionData& dataRef);
+		~ExtensionController();
 
 		void begin();
 
@@ -64,11 +107,11 @@ namespace NintendoExtensionCtrl {
 		ExtensionType getControllerType() const;
 		boolean controllerTypeMatches() const;
 
-		uint8_t getControlData(uint8_t controlIndex) const;
+		uint8_t getControlData(uint8_t controlIndex) const { return data.controlData[controlIndex]; }
 		ExtensionData & getExtensionData() const;
 
 		size_t getRequestSize() const;
-		void setRequestSize(size_t size = MinRequestSize);
+		boolean setRequestSize(size_t size = MinRequestSize);  // 'false' if larger than the data buffer, see 'MaxRequestSize'
 
 		void printDebug(Print& output = NXC_SERIAL_DEFAULT) const;
 		void printDebugID(Print& output = NXC_SERIAL_DEFAULT) const;
@@ -76,10 +119,14 @@ namespace NintendoExtensionCtrl {
 		void printDebugRaw(uint8_t baseFormat, Print& output = NXC_SERIAL_DEFAULT) const;
 
 		static const uint8_t MinRequestSize = 6;   // Smallest reporting mode (0x37)
-		static const uint8_t MaxRequestSize = ExtensionData::ControlDataSize;
+		static const uint8_t MaxRequestSize = ExtensionData::ControlDataSize;  // Controllers set their own, to size their data
 
 		NXC_I2C_TYPE& i2c() const;  // Easily accessible I2C reference
 
+		I2CMultiplexer * getMultiplexer() const;  // nullptr if not behind a mux
+		uint8_t getMultiplexerChannel() const;
+		boolean channelSelected() const;  // true if no channel switch is needed to talk to the controller
+
 		static const uint8_t I2C_Addr = 0x52;  // Address for all extension controllers
 		static const uint8_t ID_Size = 6;  // Number of bytes for ID signature
 
@@ -98,17 +145,20 @@ namespace NintendoExtensionCtrl {
 		static ExtensionType identifyController(NXC_I2C_TYPE& i2c);
 
 		/* I2C Communication Functions, Inline Member */
-		inline boolean initialize() const { return initialize(data.i2c); }
+		/* (these select the multiplexer channel first, if the controller is behind one) */
+		inline boolean selectChannel() const { return data.mux == nullptr || data.mux->select(data.muxChannel); }
 
-		inline boolean writeRegister(byte reg, byte value) const { return writeRegister(data.i2c, reg, value); }
-		inline boolean readRegister(byte reg, uint8_t* dataOut) const { return readRegister(data.i2c, reg, dataOut); }
-		inline uint8_t readRegister(byte reg) const { return readRegister(data.i2c, reg); }
+		inline boolean initialize() const { return selectChannel() && initialize(data.i2c); }
 
-		inline boolean requestData(uint8_t ptr, size_t size, uint8_t* dataOut) const { return requestData(data.i2c, ptr, size, dataOut); }
-		inline boolean requestControlData(size_t size, uint8_t* controlData) const { return requestControlData(data.i2c, size, controlData); }
-		inline boolean requestIdentity(uint8_t* idData) const { return requestIdentity(data.i2c, idData); }
+		inline boolean writeRegister(byte reg, byte value) const { return selectChannel() && writeRegister(data.i2c, reg, value); }
+		inline boolean readRegister(byte reg, uint8_t* dataOut) const { return selectChannel() && readRegister(data.i2c, reg, dataOut); }
+		inline uint8_t readRegister(byte reg) const { selectChannel(); return readRegister(data.i2c, reg); }
 
-		inline ExtensionType identifyController() const { return data.connectedType = identifyController(data.i2c); }
+		inline boolean requestData(uint8_t ptr, size_t size, uint8_t* dataOut) const { return selectChannel() && requestData(data.i2c, ptr, size, dataOut); }
+		inline boolean requestControlData(size_t size, uint8_t* controlData) const { return selectChannel() && requestControlData(data.i2c, size, controlData); }
+		inline boolean requestIdentity(uint8_t* idData) const { return selectChannel() && requestIdentity(data.i2c, idData); }
+
+		ExtensionType identifyController() const;  // also saves the ID's subtype, see 'getControllerSubtype'
 
 	protected:
 		typedef NintendoExtensionCtrl::IndexMap  IndexMap;
@@ -135,26 +185,48 @@ namespace NintendoExtensionCtrl {
 			return !(data.controlData[map.index] & (1 << map.position));  // Inverted logic, '0' is pressed
 		}
 
+		template<class MapSet>
+		uint16_t getControlBits() const {
+			return BitGather<MapSet>::apply(data.controlData);  // packed 'MapSet::PackedButtons', '1' is pressed
+		}
+
 		void setControlData(uint8_t index, uint8_t val);
 
+		uint8_t getControllerSubtype() const;  // ID byte 0 from the last 'identifyController()'
+
+		// Controller-specific handling of new data, called after every successful
+		// update. This runs for the controller that connected, so it works the
+		// same whether the update comes from the controller itself, from a port
+		// it shares data with, or from a scheduler.
+		virtual void specificUpdate();
+
+		void setActive(ExtensionController& controller);  // controller to call 'specificUpdate()' on
+
 	private:
 		ExtensionData &data;  // I2C and shared connection data
 	};
 
 	// Simple struct to wrap the ExtensionData into an instance. This lets us inherit this wrapper
 	// to initialize the data before the inherited ExtensionController instance is initialized
+	template <uint8_t DataSize>
 	struct ExtensionDataWrapper {
-		ExtensionController::ExtensionData dataInstance;
+		ExtensionController::ExtensionDataOf<DataSize> dataInstance;
 	};
 
 	// 'Bundled' template that combines an ExtensionData instance (via inherited wrapper) and an
-	// instance of ExtensionController into a single class
-	template <class ControllerSource>
-	class ExtensionClassBundle : protected ExtensionDataWrapper, public ControllerSource {
+	// instance of ExtensionController into a single class. The data is sized for the largest
+	// request the controller makes.
+	template <class ControllerSource, uint8_t DataSize = ControllerSource::MaxRequestSize>
+	class ExtensionClassBundle : protected ExtensionDataWrapper<DataSize>, public ControllerSource {
 	public:
 		ExtensionClassBundle(NXC_I2C_TYPE& i2cBus = NXC_I2C_DEFAULT) :
-			ExtensionDataWrapper({ i2cBus }),
-			ControllerSource(dataInstance)
+			ExtensionDataWrapper<DataSize>{ { i2cBus } },
+			ControllerSource(this->dataInstance)
+		{}
+
+		ExtensionClassBundle(I2CMultiplexer& mux, uint8_t channel) :
+			ExtensionDataWrapper<DataSize>{ { mux, channel } },
+			ControllerSource(this->dataInstance)
 		{}
 	};
 
@@ -221,13 +293,126 @@ namespace NintendoExtensionCtrl {
 		using ExtensionClassBundle<ControllerMap>::ExtensionClassBundle;
 
 		using Shared = ExtensionPortVariant<ControllerMap>;
+		using Base = ControllerMap;
+	};
+
+
+	// Recursive storage for the controller maps of a fixed-type port. Each level
+	// holds one controller map instance sharing the port's data, and the 'dispatch'
+	// function unrolls at compile time into a series of type comparisons. All calls
+	// into the maps are qualified, so they're bound statically rather than through
+	// the vtable.
+	template <class T>
+	struct TypeTag {};  // empty type for overload selection
+
+	template <class... ControllerMaps>
+	class ExtensionVariantSet;
+
+	template <>
+	class ExtensionVariantSet<> {
+	public:
+		ExtensionVariantSet(ExtensionController::ExtensionData&) {}
+
+		boolean dispatch(ExtensionType, boolean success, ExtensionController*&) {
+			return success;  // no matching variants, keep the result from the generic connect
+		}
+
+		void get(TypeTag<void>) {}  // end of the chain, so derived classes have something to 'use'
+	};
+
+	template <class ControllerMap, class... Others>
+	class ExtensionVariantSet<ControllerMap, Others...> : public ExtensionVariantSet<Others...> {
+	public:
+		ExtensionVariantSet(ExtensionController::ExtensionData& dataRef) :
+			ExtensionVariantSet<Others...>(dataRef),
+			variant(dataRef)
+		{}
+
+		boolean dispatch(ExtensionType type, boolean success, ExtensionController*& match) {
+			const ExtensionType expected = variant.ControllerMap::getExpectedType();
+
+			if (type == expected || (expected == ExtensionType::AnyController && type != ExtensionType::NoController)) {
+				success = variant.ControllerMap::specificInit();
+				if (success) {
+					match = &variant;
+					return true;  // found our match, we're done
+				}
+			}
+			return ExtensionVariantSet<Others...>::dispatch(type, success, match);
+		}
+
+		using ExtensionVariantSet<Others...>::get;
+		ControllerMap & get(TypeTag<ControllerMap>) { return variant; }
+
+	private:
+		ControllerMap variant;
+	};
+
+
+	// Largest 'MaxRequestSize' of a set of controllers, to size the data they share
+	template <class... Controllers>
+	struct MaxRequestSizeOf {
+		static const uint8_t value = ExtensionController::MinRequestSize;
+	};
+
+	template <class Controller, class... Others>
+	struct MaxRequestSizeOf<Controller, Others...> {
+		static const uint8_t value = (Controller::MaxRequestSize > MaxRequestSizeOf<Others...>::value) ?
+			Controller::MaxRequestSize : MaxRequestSizeOf<Others...>::value;
+	};
+
+
+	// This is the fixed-type version of the 'port' class. Instead of building
+	// a linked list of variants at runtime, the controller types are given
+	// as template arguments (e.g. ExtensionPortOf<Nunchuk, ClassicController>)
+	// and the port holds an instance of each. On connection the identity is
+	// matched against each type with no list walking and no virtual calls.
+	template <class... Controllers>
+	class ExtensionPortOf : public ExtensionClassBundle<ExtensionController, MaxRequestSizeOf<Controllers...>::value> {
+		using Bundle = ExtensionClassBundle<ExtensionController, MaxRequestSizeOf<Controllers...>::value>;
+
+	public:
+		ExtensionPortOf(NXC_I2C_TYPE& i2cBus = NXC_I2C_DEFAULT) :
+			Bundle(i2cBus),
+			variants(this->dataInstance)
+		{}
+
+		ExtensionPortOf(I2CMultiplexer& mux, uint8_t channel) :
+			Bundle(mux, channel),
+			variants(this->dataInstance)
+		{}
+
+		boolean connect() {
+			// start by running the default 'connect' function, looking for any controller
+			boolean success = ExtensionController::connect();
+			if (!success) return false;  // no connection, no reason to check variants
+
+			ExtensionController * match = this;
+			success = variants.dispatch(this->getControllerType(), success, match);
+			this->setActive(*match);  // matched variant gets the update calls
+
+			return success;
+		}
+
+		template <class Controller>
+		typename Controller::Base & get() {
+			return variants.get(TypeTag<typename Controller::Base>());
+		}
+
+	private:
+		ExtensionVariantSet<typename Controllers::Base...> variants;
 	};
 
 }  // End NintendoExtensionCtrl namespace
 
-// Public-facing version of the extension 'port' class that combines the 
+// Public-facing version of the extension 'port' class that combines the
 // communication (ExtensionController) with a data instance (ExtensionData), but omits
 // any controller-specific data maps.
 using ExtensionPort = NintendoExtensionCtrl::ExtensionPort;
 
+// Fixed-type version of the above, where the supported controller types are set
+// at compile time rather than added with 'Shared' variants
+template <class... Controllers>
+using ExtensionPortOf = NintendoExtensionCtrl::ExtensionPortOf<Controllers...>;
+
 #endif
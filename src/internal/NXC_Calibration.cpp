@@ -0,0 +1,279 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "NXC_Calibration.h"
+
+namespace NintendoExtensionCtrl {
+
+AxisCalibrationBase::AxisCalibrationBase(int16_t * tableData, uint8_t bits)
+	: table(tableData), maxInput((1 << bits) - 1)
+{
+	reset();
+}
+
+void AxisCalibrationBase::learn(uint8_t value) {
+	if (!learning) return;
+	if (value > maxInput) value = maxInput;
+
+	if (!seeded) {
+		// The first value is taken as the center. Until the real extremes
+		// are seen, assume the range is at least half of the full scale so
+		// that small movements don't jump to the ends of the output.
+		const uint8_t quarter = (maxInput + 1) / 4;
+		center = value;
+		minValue = (value > quarter) ? value - quarter : 0;
+		maxValue = (maxInput - value > quarter) ? value + quarter : maxInput;
+		seeded = true;
+		rebuild();
+		return;
+	}
+
+	if (value < minValue) minValue = value;
+	else if (value > maxValue) maxValue = value;
+	else return;  // no change, nothing to rebuild
+
+	rebuild();
+}
+
+void AxisCalibrationBase::setRange(uint8_t min, uint8_t c, uint8_t max) {
+	minValue = min;
+	center = c;
+	maxValue = max;
+	seeded = true;
+	rebuild();
+}
+
+void AxisCalibrationBase::setDeadzone(uint8_t counts) {
+	deadzone = counts;
+	rebuild();
+}
+
+void AxisCalibrationBase::setLearning(boolean enable) {
+	learning = enable;
+}
+
+void AxisCalibrationBase::reset() {
+	// Full range, centered, until something is learned
+	minValue = 0;
+	center = (maxInput + 1) / 2;
+	maxValue = maxInput;
+	seeded = false;
+	rebuild();
+}
+
+uint8_t AxisCalibrationBase::getMin() const {
+	return minValue;
+}
+
+uint8_t AxisCalibrationBase::getCenter() const {
+	return center;
+}
+
+uint8_t AxisCalibrationBase::getMax() const {
+	return maxValue;
+}
+
+uint8_t AxisCalibrationBase::getDeadzone() const {
+	return deadzone;
+}
+
+void AxisCalibrationBase::rebuild() {
+	/* Each half of the table (above and below the center) is a straight
+	 * line from the edge of the deadzone to the end of the range. Rather
+	 * than dividing for every entry, each half works out its step size
+	 * once, in 8.8 fixed point, and adds it up along the table. Anything
+	 * past the end of the range is held at the max output.
+	 */
+	const uint8_t upperStart = (maxInput - center > deadzone) ? center + deadzone : maxInput;
+	const uint8_t lowerStart = (center > deadzone) ? center - deadzone : 0;
+
+	for (uint16_t i = lowerStart; i <= upperStart; i++) {
+		table[i] = 0;
+	}
+
+	const uint32_t Full = (uint32_t) OutputMax << 8;
+
+	uint16_t span = (maxValue > upperStart) ? maxValue - upperStart : 0;
+	uint32_t step = span ? (Full + span - 1) / span : Full;  // round up, so the end of the range is full scale
+	uint32_t total = 0;
+	for (uint16_t i = upperStart + 1; i <= maxInput; i++) {
+		total += step;
+		if (total > Full) total = Full;
+		table[i] = total >> 8;
+	}
+
+	span = (lowerStart > minValue) ? lowerStart - minValue : 0;
+	step = span ? (Full + span - 1) / span : Full;
+	total = 0;
+	for (int16_t i = (int16_t) lowerStart - 1; i >= 0; i--) {
+		total += step;
+		if (total > Full) total = Full;
+		table[i] = -(int16_t) (total >> 8);
+	}
+}
+
+StickCalibrationBase::StickCalibrationBase(AxisCalibrationBase& xAxis, AxisCalibrationBase& yAxis)
+	: x(xAxis), y(yAxis) {}
+
+void StickCalibrationBase::update(uint8_t rawX, uint8_t rawY) {
+	outX = x.update(rawX);
+	outY = y.update(rawY);
+
+	if (radius != 0) {
+		// Compare the squared distance, so there's no square root
+		const uint32_t distance = (uint32_t) ((int32_t) outX * outX) + (uint32_t) ((int32_t) outY * outY);
+		if (distance < (uint32_t) radius * radius) {
+			outX = outY = 0;
+		}
+	}
+}
+
+int16_t StickCalibrationBase::getX() const {
+	return outX;
+}
+
+int16_t StickCalibrationBase::getY() const {
+	return outY;
+}
+
+void StickCalibrationBase::setRadialDeadzone(uint16_t r) {
+	radius = r;
+}
+
+AxisCalibrationBase & StickCalibrationBase::axisX() const {
+	return x;
+}
+
+AxisCalibrationBase & StickCalibrationBase::axisY() const {
+	return y;
+}
+
+TabletCalibration::TabletCalibration(uint16_t max) : inputMax(max) {}
+
+boolean TabletCalibration::calibrate(const Point * points, uint8_t count) {
+	if (count < 3) return false;
+
+	// Least squares fit, around the mean so that the sums stay small enough
+	// for single precision floats
+	float meanX = 0, meanY = 0, meanSX = 0, meanSY = 0;
+	for (uint8_t i = 0; i < count; i++) {
+		meanX += points[i].penX;
+		meanY += points[i].penY;
+		meanSX += points[i].screenX;
+		meanSY += points[i].screenY;
+	}
+	meanX /= count;
+	meanY /= count;
+	meanSX /= count;
+	meanSY /= count;
+
+	float uu = 0, uv = 0, vv = 0;  // pen
+	float usx = 0, vsx = 0, usy = 0, vsy = 0;  // pen to screen
+	for (uint8_t i = 0; i < count; i++) {
+		const float u = points[i].penX - meanX;
+		const float v = points[i].penY - meanY;
+		const float sx = points[i].screenX - meanSX;
+		const float sy = points[i].screenY - meanSY;
+
+		uu += u * u;
+		uv += u * v;
+		vv += v * v;
+		usx += u * sx;
+		vsx += v * sx;
+		usy += u * sy;
+		vsy += v * sy;
+	}
+
+	const float det = uu * vv - uv * uv;
+	if (det <= uu * vv * 0.001f) return false;  // points (nearly) in a line
+
+	const float coef[2][3] = {
+		{ (usx * vv - vsx * uv) / det, (vsx * uu - usx * uv) / det, 0 },
+		{ (usy * vv - vsy * uv) / det, (vsy * uu - usy * uv) / det, 0 },
+	};
+	const float offset[2] = {
+		meanSX - coef[0][0] * meanX - coef[0][1] * meanY,
+		meanSY - coef[1][0] * meanX - coef[1][1] * meanY,
+	};
+
+	// Use as many fraction bits as possible while every sum still fits in
+	// 32 bits, with a bit to spare
+	float largest = 0;
+	for (uint8_t i = 0; i < 2; i++) {
+		const float sum = (fabs(coef[i][0]) + fabs(coef[i][1])) * inputMax + fabs(offset[i]) + 1;
+		if (sum > largest) largest = sum;
+	}
+	uint8_t s = 0;
+	while (s < MaxShift && largest * (float) (1UL << (s + 1)) < 1073741824.0f) s++;  // 2^30
+
+	const float scale = (float) (1UL << s);
+	int32_t * const out[2] = { xCoef, yCoef };
+	for (uint8_t i = 0; i < 2; i++) {
+		out[i][0] = (int32_t) floor(coef[i][0] * scale + 0.5f);
+		out[i][1] = (int32_t) floor(coef[i][1] * scale + 0.5f);
+		out[i][2] = (int32_t) floor(offset[i] * scale + 0.5f) + (s ? (1L << (s - 1)) : 0);  // round to nearest
+	}
+	shift = s;
+	fit = true;
+
+	return true;
+}
+
+void TabletCalibration::setScreenSize(uint16_t w, uint16_t h) {
+	width = w;
+	height = h;
+}
+
+boolean TabletCalibration::map(uint16_t penX, uint16_t penY, int16_t& screenX, int16_t& screenY) const {
+	const int32_t x = (xCoef[0] * penX + xCoef[1] * penY + xCoef[2]) >> shift;
+	const int32_t y = (yCoef[0] * penX + yCoef[1] * penY + yCoef[2]) >> shift;
+
+	boolean inside = true;
+	screenX = clamp(x, width, inside);
+	screenY = clamp(y, height, inside);
+	return inside;
+}
+
+boolean TabletCalibration::calibrated() const {
+	return fit;
+}
+
+uint8_t TabletCalibration::getShift() const {
+	return shift;
+}
+
+int16_t TabletCalibration::clamp(int32_t value, uint16_t size, boolean& inside) {
+	const int32_t lower = size ? 0 : -32768;
+	const int32_t upper = size ? (int32_t) size - 1 : 32767;
+
+	if (value < lower) {
+		inside = false;
+		return lower;
+	}
+	else if (value > upper) {
+		inside = false;
+		return upper;
+	}
+	return value;
+}
+
+}  // End "NintendoExtensionCtrl" namespace
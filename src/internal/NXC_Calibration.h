@@ -0,0 +1,176 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NXC_CALIBRATION_H
+#define NXC_CALIBRATION_H
+
+#include "NXC_Comms.h"
+
+namespace NintendoExtensionCtrl {
+
+	// Calibration for one analog axis: a joystick axis, trigger, etc. The
+	// axis learns its min / max as it's used (or has them set), and maps the
+	// raw value to a signed 16-bit output with 0 at the center, with an
+	// optional deadzone around the center. All of the math is done up front
+	// into a lookup table whenever the calibration changes, so normalizing
+	// a value is a single table read.
+	//
+	// For triggers and other one-sided controls, set the center at the
+	// resting position (usually the min) and the output is 0 to OutputMax.
+	class AxisCalibrationBase {
+	public:
+		void learn(uint8_t value);  // widen the range to include this value
+		int16_t normalize(uint8_t value) const { return table[value > maxInput ? maxInput : value]; }
+		int16_t update(uint8_t value) { learn(value); return normalize(value); }
+
+		void setRange(uint8_t min, uint8_t center, uint8_t max);
+		void setDeadzone(uint8_t counts);  // raw counts, either side of the center
+		void setLearning(boolean enable);  // learn the range from new values (default on)
+		void reset();  // forget the range, and re-learn the center from the next value
+
+		uint8_t getMin() const;
+		uint8_t getCenter() const;
+		uint8_t getMax() const;
+		uint8_t getDeadzone() const;
+
+		static const int16_t OutputMax = 32767;
+
+	protected:
+		AxisCalibrationBase(int16_t * tableData, uint8_t bits);
+
+	private:
+		void rebuild();
+
+		int16_t * const table;
+		const uint8_t maxInput;  // largest raw value, (2^bits) - 1
+
+		uint8_t minValue;
+		uint8_t center;
+		uint8_t maxValue;
+		uint8_t deadzone = 0;
+
+		boolean learning = true;
+		boolean seeded = false;  // center has been set from a value
+	};
+
+	// Sized version of the axis calibration, which includes the lookup table
+	// for every raw value. Note that this is 2 bytes per value: 512 bytes
+	// for an 8-bit axis, 128 bytes for a 6-bit one.
+	template <uint8_t Bits>
+	class AxisCalibration : public AxisCalibrationBase {
+	public:
+		static_assert(Bits > 0 && Bits <= 8, "Axis calibration supports 1-8 bit values");
+
+		AxisCalibration() : AxisCalibrationBase(tableData, Bits) {}
+
+	private:
+		int16_t tableData[1 << Bits];
+	};
+
+	// Calibration for a pair of axes, e.g. a joystick. On top of the axial
+	// deadzone for each axis this can also apply a radial deadzone, which
+	// zeroes both axes if the stick as a whole is close to the center.
+	class StickCalibrationBase {
+	public:
+		void update(uint8_t rawX, uint8_t rawY);
+
+		int16_t getX() const;  // from the last update
+		int16_t getY() const;
+
+		void setRadialDeadzone(uint16_t radius);  // in output units, 0 for none
+
+		AxisCalibrationBase & axisX() const;
+		AxisCalibrationBase & axisY() const;
+
+	protected:
+		StickCalibrationBase(AxisCalibrationBase& x, AxisCalibrationBase& y);
+
+	private:
+		AxisCalibrationBase & x;
+		AxisCalibrationBase & y;
+
+		int16_t outX = 0;
+		int16_t outY = 0;
+		uint16_t radius = 0;
+	};
+
+	template <uint8_t Bits>
+	class StickCalibration : public StickCalibrationBase {
+	public:
+		StickCalibration() : StickCalibrationBase(xData, yData) {}
+
+	private:
+		AxisCalibration<Bits> xData;
+		AxisCalibration<Bits> yData;
+	};
+
+	// Maps tablet pen coordinates to screen coordinates, from 3 or more
+	// points where both are known (e.g. the pen tapped on the corners of the
+	// screen). The fit is affine, so it covers scale, offset, rotation, and
+	// skew, and with more than 3 points it's a least squares fit. The fit is
+	// worked out once in floating point and stored in fixed point, so
+	// mapping a sample is only integer multiplies and a shift.
+	class TabletCalibration {
+	public:
+		struct Point {
+			uint16_t penX;
+			uint16_t penY;
+			int16_t screenX;
+			int16_t screenY;
+		};
+
+		TabletCalibration(uint16_t inputMax);  // largest pen value, e.g. 4095 for the uDraw
+
+		boolean calibrate(const Point * points, uint8_t count);  // 'false' if the points can't be fit (e.g. all in a line)
+		void setScreenSize(uint16_t width, uint16_t height);  // output is clamped to this, 0 for no limit
+
+		boolean map(uint16_t penX, uint16_t penY, int16_t& screenX, int16_t& screenY) const;  // 'false' if clamped
+
+		boolean calibrated() const;
+		uint8_t getShift() const;  // fraction bits of the fixed point coefficients
+
+		static const uint8_t MaxShift = 24;
+
+	private:
+		static int16_t clamp(int32_t value, uint16_t size, boolean& inside);
+
+		const uint16_t inputMax;
+
+		int32_t xCoef[3] = { 1, 0, 0 };  // pen X, pen Y, offset. Starts as 1:1.
+		int32_t yCoef[3] = { 0, 1, 0 };
+		uint8_t shift = 0;
+		boolean fit = false;
+
+		uint16_t width = 0;
+		uint16_t height = 0;
+	};
+}
+
+template <uint8_t Bits>
+using AxisCalibration = NintendoExtensionCtrl::AxisCalibration<Bits>;
+
+template <uint8_t Bits>
+using StickCalibration = NintendoExtensionCtrl::StickCalibration<Bits>;
+
+using TabletCalibration = NintendoExtensionCtrl::TabletCalibration;
+
+#endif
@@ -50,6 +50,82 @@ namespace NintendoExtensionCtrl {
 		const uint8_t index;     // Index in the control data array
 		const uint8_t position;  // Position of the bit, from right
 	};
+
+	// Number of data bits described by a map, e.g. for scaling to a full byte
+	constexpr uint8_t bitCount(uint8_t value) {
+		return value == 0 ? 0 : (value & 1) + bitCount(value >> 1);
+	}
+
+	constexpr uint8_t bitWidth(IndexMap) {
+		return 8;
+	}
+
+	constexpr uint8_t bitWidth(const ByteMap& map) {
+		return bitCount(map.mask);
+	}
+
+	template<size_t N>
+	constexpr uint8_t bitWidth(const ByteMap(&map)[N], size_t i = 0) {
+		return i >= N ? 0 : bitWidth(map[i]) + bitWidth(map, i + 1);
+	}
+
+	// Compile-time 'gather' for packing a list of BitMaps into a single mask,
+	// where bit 'n' of the output comes from the n-th BitMap in the list. The
+	// list is read from 'MapSet::PackedButtons', and all bits must lie within
+	// two adjacent bytes of the control data.
+	//
+	// Rather than extracting each bit on its own, output bits are grouped by
+	// the distance they need to move. Each group is then one shift and one
+	// mask, all of which are calculated by the compiler. Groups with no bits
+	// have a zero mask and are optimized away.
+	template<class MapSet>
+	class BitGather {
+	public:
+		static uint16_t apply(const uint8_t * controlData) {
+			uint16_t raw = controlData[First];
+			if (Last != First) raw |= controlData[First + 1] << 8;
+			return Step<-15>::apply(~raw);  // Inverted logic, '0' is pressed
+		}
+
+	private:
+		template<size_t N>
+		constexpr static uint8_t minIndex(const BitMap(&maps)[N], size_t i = 0, uint8_t out = 0xFF) {
+			return i >= N ? out : minIndex(maps, i + 1, maps[i].index < out ? maps[i].index : out);
+		}
+
+		template<size_t N>
+		constexpr static uint8_t maxIndex(const BitMap(&maps)[N], size_t i = 0, uint8_t out = 0x00) {
+			return i >= N ? out : maxIndex(maps, i + 1, maps[i].index > out ? maps[i].index : out);
+		}
+
+		// Output bits whose source bit is 'delta' positions to the left of them
+		template<size_t N>
+		constexpr static uint16_t groupMask(const BitMap(&maps)[N], int delta, size_t i = 0) {
+			return i >= N ? 0 :
+				((((maps[i].index - First) * 8 + maps[i].position) - (int) i == delta) ? (1U << i) : 0)
+				| groupMask(maps, delta, i + 1);
+		}
+
+		constexpr static uint8_t First = minIndex(MapSet::PackedButtons);
+		constexpr static uint8_t Last = maxIndex(MapSet::PackedButtons);
+
+		static_assert(Last - First <= 1, "Packed buttons must be within two adjacent bytes");
+
+		template<int Delta, bool End = (Delta > 15)>
+		struct Step {
+			constexpr static uint16_t Mask = groupMask(MapSet::PackedButtons, Delta);
+
+			static uint16_t apply(uint16_t raw) {
+				const uint16_t shifted = (Delta >= 0) ? (raw >> (Delta >= 0 ? Delta : 0)) : (raw << (Delta < 0 ? -Delta : 0));
+				return (shifted & Mask) | Step<Delta + 1>::apply(raw);
+			}
+		};
+
+		template<int Delta>
+		struct Step<Delta, true> {
+			static uint16_t apply(uint16_t) { return 0; }
+		};
+	};
 }
 
 #endif
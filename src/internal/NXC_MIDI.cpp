@@ -0,0 +1,226 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "NXC_MIDI.h"
+
+namespace NintendoExtensionCtrl {
+
+namespace {
+	const uint8_t NoteOn = 0x90;
+	const uint8_t ControlChange = 0xB0;
+
+	// Guitar: frets as a C major scale, strum and +/- as extra notes
+	const uint8_t GuitarNotes[9] = {
+		72, 71,  // strum up, down
+		60, 62, 64, 65, 67,  // frets green -> orange
+		48, 47,  // plus, minus
+	};
+	const uint8_t GuitarControls[4] = {
+		1,   // whammy bar (modulation)
+		16,  // touchbar
+		17, 18,  // joystick X, Y
+	};
+
+	// Drums: General MIDI percussion notes
+	const uint8_t DrumNotes[8] = {
+		38, 48, 45,  // snare (red), hi-mid tom (blue), low tom (green)
+		42, 49,  // closed hi-hat (yellow), crash (orange)
+		36,  // bass drum (pedal)
+		MIDIEncoder::NoNote, MIDIEncoder::NoNote,  // plus, minus
+	};
+	const uint8_t DrumControls[2] = {
+		16, 17,  // joystick X, Y
+	};
+
+	// DJ: one octave of buttons, starting from C
+	const uint8_t DJNotes[9] = {
+		60, 62, 64,  // left green, red, blue
+		65, 67, 69,  // right green, red, blue
+		71,  // euphoria
+		48, 47,  // plus, minus
+	};
+	const uint8_t DJControls[6] = {
+		16, 17,  // turntables left, right (relative, 64 is stopped)
+		18,  // crossfade slider
+		19,  // effect dial
+		20, 21,  // joystick X, Y
+	};
+
+	uint8_t drumVelocity(uint8_t velocity) {
+		if (velocity == 0) return MIDIEncoder::DefaultVelocity;  // missed
+		return (velocity * 127 + 3) / 7;  // 1-7 to 18-127
+	}
+}
+
+const MIDIEncoder::Mapping MIDIEncoder::GuitarMap = { GuitarNotes, sizeof(GuitarNotes), GuitarControls, sizeof(GuitarControls) };
+const MIDIEncoder::Mapping MIDIEncoder::DrumMap = { DrumNotes, sizeof(DrumNotes), DrumControls, sizeof(DrumControls) };
+const MIDIEncoder::Mapping MIDIEncoder::DJMap = { DJNotes, sizeof(DJNotes), DJControls, sizeof(DJControls) };
+
+MIDIEncoder::MIDIEncoder(const Mapping& mapping, uint8_t ch) : map(mapping) {
+	setChannel(ch);
+	reset();
+}
+
+void MIDIEncoder::setBuffer(uint8_t * buf, uint8_t size) {
+	buffer = buf;
+	bufferSize = size;
+	bufferLength = 0;
+}
+
+uint8_t MIDIEncoder::length() const {
+	return bufferLength;
+}
+
+void MIDIEncoder::clear() {
+	bufferLength = 0;
+}
+
+uint8_t MIDIEncoder::space() const {
+	return bufferSize - bufferLength;
+}
+
+boolean MIDIEncoder::write(uint8_t status, uint8_t data1, uint8_t data2) {
+	status |= channel;
+	const uint8_t size = (status == runningStatus) ? 2 : 3;
+	if (buffer == nullptr || space() < size) return false;
+
+	if (size == 3) {
+		buffer[bufferLength++] = status;
+		runningStatus = status;
+	}
+	buffer[bufferLength++] = data1 & 0x7F;
+	buffer[bufferLength++] = data2 & 0x7F;
+	return true;
+}
+
+boolean MIDIEncoder::noteOn(uint8_t note, uint8_t velocity) {
+	if (velocity == 0) velocity = 1;  // 0 is note off
+	return write(NoteOn, note, velocity);
+}
+
+boolean MIDIEncoder::noteOff(uint8_t note) {
+	return write(NoteOn, note, 0);  // shares the running status with note on
+}
+
+boolean MIDIEncoder::controlChange(uint8_t control, uint8_t value) {
+	return write(ControlChange, control, value);
+}
+
+void MIDIEncoder::encodeButtons(uint16_t buttons) {
+	const uint16_t changed = buttons ^ sentButtons;
+	if (changed == 0) return;
+
+	for (uint8_t i = 0; i < map.numNotes; i++) {
+		const uint16_t mask = 1 << i;
+		if (!(changed & mask)) continue;
+
+		if (map.notes[i] != NoNote) {
+			const boolean sent = (buttons & mask) ? noteOn(map.notes[i]) : noteOff(map.notes[i]);
+			if (!sent) return;  // buffer full, try again next time
+		}
+		sentButtons ^= mask;
+	}
+}
+
+void MIDIEncoder::encodeControls(const uint8_t * values) {
+	for (uint8_t i = 0; i < map.numControls && i < MaxControls; i++) {
+		const uint8_t value = values[i] & 0x7F;
+		if (value == sentControls[i]) continue;
+
+		if (!controlChange(map.controls[i], value)) return;  // buffer full
+		sentControls[i] = value;
+	}
+}
+
+void MIDIEncoder::encode(const GuitarControllerBase & guitar) {
+	encodeButtons(guitar.buttons());
+
+	const uint8_t values[4] = {
+		(uint8_t) (guitar.whammyBar() << 2),
+		(uint8_t) (guitar.touchbar() << 2),
+		(uint8_t) (guitar.joyX() << 1),
+		(uint8_t) (guitar.joyY() << 1),
+	};
+	encodeControls(values);
+}
+
+void MIDIEncoder::encode(const DrumControllerBase & drums, DrumControllerBase::HitDecoder & hits) {
+	// Pads are sent as hits so that they have a velocity. The note off follows
+	// right away, as the pads have no sustain.
+	DrumControllerBase::HitDecoder::Hit hit;
+	while (hits.available() && space() >= 6 && hits.read(hit)) {
+		for (uint8_t i = 0; i < DrumControllerBase::HitDecoder::NumPads && i < map.numNotes; i++) {
+			if (DrumControllerBase::HitDecoder::PadIDs[i] != hit.pad) continue;
+			if (map.notes[i] == NoNote) break;
+
+			noteOn(map.notes[i], drumVelocity(hit.velocity));
+			noteOff(map.notes[i]);
+			break;
+		}
+	}
+
+	const uint16_t padMask = (1 << DrumControllerBase::HitDecoder::NumPads) - 1;
+	encodeButtons((drums.buttons() & ~padMask) | (sentButtons & padMask));  // others, pads unchanged
+
+	const uint8_t values[2] = {
+		(uint8_t) (drums.joyX() << 1),
+		(uint8_t) (drums.joyY() << 1),
+	};
+	encodeControls(values);
+}
+
+void MIDIEncoder::encode(const DJTurntableControllerBase & dj) {
+	encodeButtons(dj.buttons());
+
+	const uint8_t values[6] = {
+		(uint8_t) (64 + dj.left.turntable()),
+		(uint8_t) (64 + dj.right.turntable()),
+		(uint8_t) (dj.crossfadeSlider() << 3),
+		(uint8_t) (dj.effectDial() << 2),
+		(uint8_t) (dj.joyX() << 1),
+		(uint8_t) (dj.joyY() << 1),
+	};
+	encodeControls(values);
+}
+
+void MIDIEncoder::setChannel(uint8_t ch) {
+	channel = ch & 0x0F;
+	runningStatus = 0;
+}
+
+uint8_t MIDIEncoder::getChannel() const {
+	return channel;
+}
+
+void MIDIEncoder::resetRunningStatus() {
+	runningStatus = 0;
+}
+
+void MIDIEncoder::reset() {
+	runningStatus = 0;
+	sentButtons = 0;
+	for (uint8_t i = 0; i < MaxControls; i++) {
+		sentControls[i] = 0xFF;
+	}
+}
+
+}  // End "NintendoExtensionCtrl" namespace
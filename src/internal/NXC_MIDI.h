@@ -0,0 +1,102 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NXC_MIDI_H
+#define NXC_MIDI_H
+
+#include "../controllers/GuitarController.h"
+#include "../controllers/DrumController.h"
+#include "../controllers/DJTurntable.h"
+
+namespace NintendoExtensionCtrl {
+
+	// MIDI encoder for the instrument controllers. Buttons are mapped to notes
+	// and analog controls to control changes (CC) through a mapping table,
+	// and each call only writes what changed since the last one: note on / off
+	// for buttons that were pressed or released, and CC messages for controls
+	// with a new value. Messages use running status, and note off is sent as
+	// a note on with a velocity of 0 so that a burst of notes shares a single
+	// status byte.
+	//
+	// Output goes to a buffer supplied by the caller. Messages are only written
+	// whole, and any change that doesn't fit in the buffer is kept and sent
+	// by the next call.
+	class MIDIEncoder {
+	public:
+		struct Mapping {
+			const uint8_t * notes;     // note for each 'Buttons' bit, or NoNote
+			uint8_t numNotes;
+			const uint8_t * controls;  // CC number for each analog value
+			uint8_t numControls;
+		};
+
+		MIDIEncoder(const Mapping& map, uint8_t channel = 0);
+
+		void setBuffer(uint8_t * buffer, uint8_t size);
+		uint8_t length() const;  // bytes written to the buffer
+		void clear();  // empty the buffer, once it has been sent
+
+		boolean noteOn(uint8_t note, uint8_t velocity = DefaultVelocity);
+		boolean noteOff(uint8_t note);
+		boolean controlChange(uint8_t control, uint8_t value);
+
+		void encodeButtons(uint16_t buttons);  // notes for the mapped buttons that changed
+		void encodeControls(const uint8_t * values);  // CCs for the mapped values (0-127) that changed
+
+		void encode(const GuitarControllerBase & guitar);
+		void encode(const DrumControllerBase & drums, DrumControllerBase::HitDecoder & hits);
+		void encode(const DJTurntableControllerBase & dj);
+
+		void setChannel(uint8_t channel);  // 0-15
+		uint8_t getChannel() const;
+
+		void resetRunningStatus();  // call if anything else was sent on the same output
+		void reset();  // forget the sent state, so every mapped note and control is sent again
+
+		static const uint8_t NoNote = 0xFF;
+		static const uint8_t MaxControls = 8;
+		static const uint8_t DefaultVelocity = 100;
+
+		static const Mapping GuitarMap;
+		static const Mapping DrumMap;  // pads are sent from the hit decoder, with velocity
+		static const Mapping DJMap;
+
+	private:
+		boolean write(uint8_t status, uint8_t data1, uint8_t data2);
+		uint8_t space() const;
+
+		const Mapping & map;
+		uint8_t channel;
+
+		uint8_t * buffer = nullptr;
+		uint8_t bufferSize = 0;
+		uint8_t bufferLength = 0;
+
+		uint8_t runningStatus = 0;  // 0 for none
+		uint16_t sentButtons = 0;  // button state the sent notes match
+		uint8_t sentControls[MaxControls];  // last value sent for each control, 0xFF for none
+	};
+}
+
+using MIDIEncoder = NintendoExtensionCtrl::MIDIEncoder;
+
+#endif
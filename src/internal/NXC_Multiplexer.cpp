@@ -0,0 +1,101 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "NXC_Multiplexer.h"
+
+namespace NintendoExtensionCtrl {
+
+I2CMultiplexer * I2CMultiplexer::head = nullptr;
+
+I2CMultiplexer::I2CMultiplexer(NXC_I2C_TYPE& i2cBus, uint8_t addr)
+	: bus(i2cBus), address(addr)
+{
+	next = head;  // add to the front of the list
+	head = this;
+}
+
+I2CMultiplexer::~I2CMultiplexer() {
+	I2CMultiplexer ** ptr = &head;
+	while (*ptr != nullptr) {
+		if (*ptr == this) {
+			*ptr = next;  // remove from the list
+			break;
+		}
+		ptr = &(*ptr)->next;
+	}
+}
+
+boolean I2CMultiplexer::select(uint8_t ch) {
+	if (ch == channel) return true;  // already there, nothing to do
+	if (ch >= NumChannels) return false;  // channel doesn't exist
+
+	if (!disableOthers()) return false;
+	if (!writeControl(1 << ch)) return false;
+	channel = ch;
+	return true;
+}
+
+boolean I2CMultiplexer::disable() {
+	if (!writeControl(0x00)) return false;
+	channel = NoChannel;
+	enabled = false;
+	return true;
+}
+
+boolean I2CMultiplexer::disableOthers() {
+	for (I2CMultiplexer * mux = head; mux != nullptr; mux = mux->next) {
+		if (mux != this && &mux->bus == &bus && mux->enabled) {
+			if (!mux->disable()) return false;
+		}
+	}
+	return true;
+}
+
+boolean I2CMultiplexer::writeControl(uint8_t value) {
+	// The mux has a single control register, so the one byte written is the
+	// channel bitmask. No conversion delay is needed after the write.
+	enabled = true;  // until the write is known to have cleared it
+	if (!i2c_writePointer(bus, address, value, false)) {
+		channel = NoChannel;  // write failed, mux state is unknown
+		return false;
+	}
+	return true;
+}
+
+uint8_t I2CMultiplexer::getChannel() const {
+	return channel;
+}
+
+void I2CMultiplexer::invalidate() {
+	channel = NoChannel;
+	enabled = true;  // unknown, so it might be on
+}
+
+NXC_I2C_TYPE & I2CMultiplexer::i2c() const {
+	return bus;
+}
+
+uint8_t I2CMultiplexer::getAddress() const {
+	return address;
+}
+
+}  // End "NintendoExtensionCtrl" namespace
@@ -0,0 +1,73 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NXC_MULTIPLEXER_H
+#define NXC_MULTIPLEXER_H
+
+#include "NXC_Comms.h"
+
+namespace NintendoExtensionCtrl {
+
+	// Driver for a TCA9548A-style I2C multiplexer. Because every extension
+	// controller uses the same address, a mux lets several controllers share
+	// a single bus. The currently selected channel is cached so that the
+	// channel-select write is skipped if the mux is already on that channel.
+	//
+	// If there are multiple multiplexers on the same bus only one of them can
+	// have a channel enabled at a time, otherwise the controllers would clash.
+	// All multiplexers are kept in a list, so selecting a channel on one first
+	// disables any other on the same bus that might have a channel enabled.
+	class I2CMultiplexer {
+	public:
+		I2CMultiplexer(NXC_I2C_TYPE& i2cBus = NXC_I2C_DEFAULT, uint8_t addr = DefaultAddress);
+		~I2CMultiplexer();
+
+		boolean select(uint8_t channel);  // switch to channel (if not already selected)
+		boolean disable();  // disable all channels
+
+		uint8_t getChannel() const;  // currently selected channel, or 'NoChannel'
+		void invalidate();  // forget the cached channel, forcing a write on the next select
+
+		NXC_I2C_TYPE & i2c() const;
+		uint8_t getAddress() const;
+
+		static const uint8_t DefaultAddress = 0x70;  // TCA9548A with A0-A2 low
+		static const uint8_t NumChannels = 8;
+		static const uint8_t NoChannel = 0xFF;  // unknown, or disabled
+
+	private:
+		boolean writeControl(uint8_t value);
+		boolean disableOthers();  // disable the other multiplexers on this bus
+
+		NXC_I2C_TYPE & bus;
+		const uint8_t address;
+		uint8_t channel = NoChannel;
+		boolean enabled = true;  // a channel may be on. 'true' until known otherwise
+
+		I2CMultiplexer * next = nullptr;  // list of all multiplexers
+		static I2CMultiplexer * head;
+	};
+}
+
+using I2CMultiplexer = NintendoExtensionCtrl::I2CMultiplexer;
+
+#endif
@@ -0,0 +1,178 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "NXC_Scheduler.h"
+
+namespace NintendoExtensionCtrl {
+
+ExtensionSchedulerBase::ExtensionSchedulerBase(Entry * entryData, uint8_t cap)
+	: entries(entryData), capacity(cap) {}
+
+boolean ExtensionSchedulerBase::add(ExtensionController& controller, uint16_t rate, uint8_t priority) {
+	if (numEntries >= capacity || rate == 0) return false;  // no room, or bad rate
+
+	Entry & e = entries[numEntries];
+
+	e.controller = &controller;
+	e.period = 1000000UL / rate;
+	e.deadline = micros();  // due immediately
+	e.priority = priority;
+
+	e.updateSuccess = false;
+	e.updateCount = 0;
+	e.rate = 0;
+	e.misses = 0;
+	e.busTime = 0;
+
+	numEntries++;
+	return true;
+}
+
+int8_t ExtensionSchedulerBase::run() {
+	unsigned long now = micros();
+	updateRates(now);
+
+	Entry * next = selectNext(now);
+	if (next == nullptr) return -1;  // nothing is due
+
+	next->updateSuccess = next->controller->update();
+	next->updateCount++;
+	next->busTime += micros() - now;
+
+	/* If we're more than a full period behind, the skipped updates count as
+	 * misses and the schedule is restarted from now rather than trying to
+	 * 'catch up' with a burst of back-to-back updates. Otherwise we keep the
+	 * original phase, so small delays don't accumulate into drift.
+	 */
+	const unsigned long late = now - next->deadline;
+	if (late >= next->period) {
+		const unsigned long skipped = late / next->period;
+		next->misses = (skipped >= 0xFFFFUL - next->misses) ? 0xFFFF : next->misses + skipped;  // saturate, don't wrap
+		next->deadline = now + next->period;
+	}
+	else {
+		next->deadline += next->period;
+	}
+
+	return next - entries;
+}
+
+ExtensionSchedulerBase::Entry * ExtensionSchedulerBase::selectNext(unsigned long now) const {
+	/* Each port that's due is scored by how late it is, plus a fixed amount
+	 * of time for each level of priority. So a higher priority port goes
+	 * first when both are about as late, but a lower priority port that keeps
+	 * getting passed over will eventually outscore it, even if the higher
+	 * priority port is always due.
+	 *
+	 * Ports that don't need a multiplexer channel switch get a smaller bonus,
+	 * about what the channel-select write would cost. That saves the write
+	 * when ports are close, but it can only put off the other ports by that
+	 * much.
+	 *
+	 * For fairness between buses, each port loses however much more time its
+	 * bus has spent on updates than the least used bus with a port that's
+	 * due. Buses that are about even barely notice, but if one bus has been
+	 * getting most of the time its ports wait until the others catch up.
+	 * Only due ports count, so a bus that has nothing to do doesn't hold the
+	 * others back. The gap closes as the other buses catch up, so nothing waits
+	 * for long.
+	 */
+	unsigned long leastBusTime = 0xFFFFFFFF;
+	for (uint8_t i = 0; i < numEntries; i++) {
+		if ((long) (entries[i].deadline - now) > 0) continue;  // not due yet
+		const unsigned long t = busTime(entries[i].controller->i2c());
+		if (t < leastBusTime) leastBusTime = t;
+	}
+
+	Entry * best = nullptr;
+	long bestScore = 0;
+
+	for (uint8_t i = 0; i < numEntries; i++) {
+		Entry & e = entries[i];
+
+		const long remaining = (long) (e.deadline - now);  // signed, in case of timer rollover
+		if (remaining > 0) continue;  // not due yet
+
+		long score = -remaining + (long) (e.priority * PriorityStep);
+		if (e.controller->channelSelected()) score += SwitchCost;  // no channel-select write needed
+		score -= (long) (busTime(e.controller->i2c()) - leastBusTime);  // bus has had more than its share
+
+		if (best == nullptr || score > bestScore) {
+			best = &e;
+			bestScore = score;
+		}
+	}
+
+	return best;
+}
+
+unsigned long ExtensionSchedulerBase::busTime(const NXC_I2C_TYPE& bus) const {
+	unsigned long total = 0;
+	for (uint8_t i = 0; i < numEntries; i++) {
+		if (&entries[i].controller->i2c() == &bus) total += entries[i].busTime;
+	}
+	return total;
+}
+
+void ExtensionSchedulerBase::updateRates(unsigned long now) {
+	const unsigned long elapsed = now - windowStart;
+	if (elapsed < RateWindow) return;  // still sampling
+
+	for (uint8_t i = 0; i < numEntries; i++) {
+		entries[i].rate = (uint16_t) (((uint32_t) entries[i].updateCount * 1000UL) / (elapsed / 1000));  // in ms to avoid overflow
+		entries[i].updateCount = 0;
+		entries[i].busTime /= 2;  // older bus use counts for less
+	}
+	windowStart = now;
+}
+
+void ExtensionSchedulerBase::resetStats() {
+	for (uint8_t i = 0; i < numEntries; i++) {
+		entries[i].updateCount = 0;
+		entries[i].rate = 0;
+		entries[i].misses = 0;
+		entries[i].busTime = 0;
+	}
+	windowStart = micros();
+}
+
+uint8_t ExtensionSchedulerBase::size() const {
+	return numEntries;
+}
+
+ExtensionController & ExtensionSchedulerBase::getController(uint8_t index) const {
+	return *entries[index].controller;
+}
+
+boolean ExtensionSchedulerBase::updateSuccess(uint8_t index) const {
+	return entries[index].updateSuccess;
+}
+
+uint16_t ExtensionSchedulerBase::getRate(uint8_t index) const {
+	return entries[index].rate;
+}
+
+uint16_t ExtensionSchedulerBase::getMisses(uint8_t index) const {
+	return entries[index].misses;
+}
+
+}  // End "NintendoExtensionCtrl" namespace
@@ -0,0 +1,105 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NXC_SCHEDULER_H
+#define NXC_SCHEDULER_H
+
+#include "ExtensionController.h"
+
+namespace NintendoExtensionCtrl {
+
+	// Scheduler for polling multiple controllers, each at its own rate. Every
+	// call to 'run()' performs at most one controller update: the most urgent
+	// port that is due. Ports are ranked by how late they are, with each level
+	// of priority counting as 'PriorityStep' of extra lateness, and not needing
+	// a multiplexer channel switch counting as 'SwitchCost' more. A port that's
+	// kept waiting keeps getting later, so it's never starved by ports of a
+	// higher priority or on a channel that's already selected.
+	//
+	// When ports on different I2C buses are due at once, each port is also put
+	// back by how much more time its bus has spent updating than the least
+	// used of those buses. So a bus with many ports can't crowd out a bus with
+	// few, and when there isn't time for everything the buses share it evenly.
+	class ExtensionSchedulerBase {
+	public:
+		struct Entry {
+			ExtensionController * controller;
+			unsigned long period;    // target update period, in microseconds
+			unsigned long deadline;  // time of the next scheduled update, in microseconds
+			uint8_t priority;        // larger is more important
+
+			boolean updateSuccess;   // result of the last update
+			uint16_t updateCount;    // updates in the current rate window
+			uint16_t rate;           // achieved updates per second, from the last window
+			uint16_t misses;         // number of scheduled updates that were skipped, saturates at 65535
+			unsigned long busTime;   // microseconds spent updating, halved every rate window
+		};
+
+		boolean add(ExtensionController& controller, uint16_t rate, uint8_t priority = 0);
+
+		int8_t run();  // update the most urgent port, returning its index (-1 if none are due)
+
+		void resetStats();
+
+		uint8_t size() const;
+		ExtensionController & getController(uint8_t index) const;
+		boolean updateSuccess(uint8_t index) const;  // result of the port's last update
+
+		uint16_t getRate(uint8_t index) const;  // updates per second
+		uint16_t getMisses(uint8_t index) const;  // deadline misses
+
+		static const unsigned long RateWindow = 1000000;  // Microseconds, rate sampling period
+		static const unsigned long PriorityStep = 1000;   // Microseconds of lateness per priority level
+		static const unsigned long SwitchCost = 200;      // Microseconds, about one channel-select write at 100 kHz
+
+	protected:
+		ExtensionSchedulerBase(Entry * entryData, uint8_t capacity);
+
+	private:
+		Entry * selectNext(unsigned long now) const;
+		unsigned long busTime(const NXC_I2C_TYPE& bus) const;  // recent update time of all ports on a bus
+		void updateRates(unsigned long now);
+
+		Entry * const entries;
+		const uint8_t capacity;
+		uint8_t numEntries = 0;
+
+		unsigned long windowStart = 0;  // start of the rate sampling window
+	};
+
+	// Sized version of the scheduler, which includes the storage for its ports
+	template <uint8_t Capacity>
+	class ExtensionScheduler : public ExtensionSchedulerBase {
+		static_assert(Capacity > 0 && Capacity <= 127, "Scheduler capacity must be 1-127, so 'run()' can return the index");
+
+	public:
+		ExtensionScheduler() : ExtensionSchedulerBase(entryData, Capacity) {}
+
+	private:
+		Entry entryData[Capacity];
+	};
+}
+
+template <uint8_t Capacity>
+using ExtensionScheduler = NintendoExtensionCtrl::ExtensionScheduler<Capacity>;
+
+#endif
@@ -0,0 +1,215 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "NXC_Strokes.h"
+
+namespace NintendoExtensionCtrl {
+
+namespace {
+	uint16_t zigzag(int16_t value) {  // 0, -1, 1, -2, 2... to 0, 1, 2, 3, 4...
+		return (uint16_t) ((uint16_t) value << 1) ^ (uint16_t) (value >> 15);
+	}
+}
+
+void StrokeRecorderBase::addSample(uint16_t x, uint16_t y, boolean down) {
+	if (!down) {
+		if (penDown && (lastX != anchorX || lastY != anchorY)) {
+			emit(lastX, lastY, false);  // end of the stroke
+		}
+		penDown = false;
+		return;
+	}
+
+	if (samples != 0xFFFFFFFF) samples++;
+
+	if (!penDown) {
+		penDown = true;
+		emit(x, y, true);
+		lastX = x;
+		lastY = y;
+		return;
+	}
+
+	if (x == lastX && y == lastY) return;  // pen hasn't moved
+
+	const int32_t dx = (int32_t) x - anchorX;
+	const int32_t dy = (int32_t) y - anchorY;
+	const int32_t tol = tolerance;
+	const boolean inSpan = abs(dx) <= MaxSpan && abs(dy) <= MaxSpan;  // checked first, so the squares below fit
+
+	if (windowSize == 0 && inSpan && dx * dx + dy * dy <= tol * tol) {
+		// Still close to the last point, so any line from it fits this
+		lastX = x;
+		lastY = y;
+		return;
+	}
+
+	if (!inSpan || !fits(x, y)) {
+		if (windowSize > 0) {
+			emit(lastX, lastY, false);  // the line to the last sample still fit
+		}
+		if (abs((int32_t) x - anchorX) > MaxSpan || abs((int32_t) y - anchorY) > MaxSpan) {
+			emit(x, y, false);  // jumped, keep it as is
+			lastX = x;
+			lastY = y;
+			return;
+		}
+	}
+
+	if (windowSize == Window) {
+		emit(x, y, false);  // out of room, the line to this sample fits
+	}
+	else {
+		windowX[windowSize] = x;
+		windowY[windowSize] = y;
+		windowSize++;
+	}
+
+	lastX = x;
+	lastY = y;
+}
+
+boolean StrokeRecorderBase::fits(uint16_t x, uint16_t y) const {
+	/* Distance from each sample to the line segment from the anchor. In the
+	 * middle of the segment this is the cross product over the length, but
+	 * to skip the square root the length is taken as the larger of |dx| and
+	 * |dy|. That's never longer than the real length, so the distance is
+	 * never underestimated. Spans are capped at 'MaxSpan' so that all of the
+	 * products fit in 32 bits.
+	 */
+	const int32_t dx = (int32_t) x - anchorX;
+	const int32_t dy = (int32_t) y - anchorY;
+	const int32_t tol = tolerance;
+
+	const int32_t lengthSq = dx * dx + dy * dy;
+	const int32_t length = (abs(dx) > abs(dy)) ? abs(dx) : abs(dy);
+
+	for (uint8_t i = 0; i < windowSize; i++) {
+		const int32_t qx = (int32_t) windowX[i] - anchorX;
+		const int32_t qy = (int32_t) windowY[i] - anchorY;
+
+		const int32_t dot = qx * dx + qy * dy;
+
+		if (dot <= 0) {  // behind the anchor
+			if (qx * qx + qy * qy > tol * tol) return false;
+		}
+		else if (dot >= lengthSq) {  // past the end
+			const int32_t ex = qx - dx;
+			const int32_t ey = qy - dy;
+			if (ex * ex + ey * ey > tol * tol) return false;
+		}
+		else {
+			const int32_t cross = qx * dy - qy * dx;
+			if (abs(cross) > tol * length) return false;
+		}
+	}
+	return true;
+}
+
+void StrokeRecorderBase::emit(uint16_t x, uint16_t y, boolean start) {
+	Point point;
+	point.dx = (int16_t) (x - anchorX);  // wraps, so 16-bit coordinates still fit
+	point.dy = (int16_t) (y - anchorY);
+	point.start = start;
+	if (queue.push(point)) {  // dropped if full
+		if (points != 0xFFFFFFFF) points++;
+	}
+
+	anchorX = x;  // the next point follows on from this one either way
+	anchorY = y;
+	windowSize = 0;
+}
+
+void StrokeRecorderBase::reset() {
+	penDown = false;
+	anchorX = anchorY = 0;
+	lastX = lastY = 0;
+	windowSize = 0;
+	queue.reset();
+	samples = points = 0;
+}
+
+uint8_t StrokeRecorderBase::available() const {
+	return queue.available();
+}
+
+boolean StrokeRecorderBase::read(Point& point) {
+	return queue.read(point);
+}
+
+boolean StrokeRecorderBase::drawing() const {
+	return penDown;
+}
+
+void StrokeRecorderBase::setTolerance(uint8_t counts) {
+	tolerance = counts;
+}
+
+uint8_t StrokeRecorderBase::getTolerance() const {
+	return tolerance;
+}
+
+void StrokeRecorderBase::setPressureThreshold(uint16_t pressure) {
+	pressureThreshold = pressure;
+}
+
+uint16_t StrokeRecorderBase::getPressureThreshold() const {
+	return pressureThreshold;
+}
+
+uint32_t StrokeRecorderBase::getSampleCount() const {
+	return samples;
+}
+
+uint32_t StrokeRecorderBase::getPointCount() const {
+	return points;
+}
+
+uint16_t StrokeRecorderBase::getDropped() const {
+	return queue.getDropped();
+}
+
+uint8_t StrokeRecorderBase::encode(const Point& point, uint8_t * out) {
+	/* Each change is zigzag encoded so small changes either way are small
+	 * numbers, then written 7 bits per byte with the
+	 * top bit set on every byte but the last. The 'start' flag rides along
+	 * as the lowest bit of X. Changes up to +/-31 on X and +/-63 on Y take
+	 * one byte each.
+	 */
+	const uint32_t values[2] = {
+		((uint32_t) zigzag(point.dx) << 1) | (point.start ? 1 : 0),
+		zigzag(point.dy),
+	};
+
+	uint8_t size = 0;
+	for (uint8_t i = 0; i < 2; i++) {
+		uint32_t value = values[i];
+		while (value >= 0x80) {
+			out[size++] = (value & 0x7F) | 0x80;
+			value >>= 7;
+		}
+		out[size++] = value;
+	}
+	return size;
+}
+
+}  // End "NintendoExtensionCtrl" namespace
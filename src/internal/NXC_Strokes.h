@@ -0,0 +1,99 @@
+/*
+*  Project     Nintendo Extension Controller Library
+*  @author     David Madison
+*  @link       github.com/dmadison/NintendoExtensionCtrl
+*  @license    LGPLv3 - Copyright (c) 2026 David Madison
+*
+*  This file is part of the Nintendo Extension Controller Library.
+*
+*  This program is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU Lesser General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NXC_STROKES_H
+#define NXC_STROKES_H
+
+#include "NXC_Utils.h"
+
+namespace NintendoExtensionCtrl {
+
+	// Records pen strokes from a tablet as a simplified, delta-encoded line.
+	// A stroke starts when the pen goes down and ends when it's lifted, and
+	// while it's down the samples are simplified as they come in: a point is
+	// only kept once the line from the last kept point can no longer pass
+	// within 'tolerance' of every sample since. This only needs the samples
+	// since the last kept point, and that's capped at 'Window' samples, so
+	// memory use is fixed.
+	//
+	// Points are queued as the change from the point before, which can be
+	// packed into as few as 2 bytes each with 'encode()'.
+	class StrokeRecorderBase {
+	public:
+		struct Point {
+			int16_t dx;  // Change from the previous point, including from the end of the last stroke
+			int16_t dy;
+			boolean start;  // 'true' for the first point of a stroke
+		};
+
+		void addSample(uint16_t x, uint16_t y, boolean down);  // one pen sample, 'down' if drawing
+		void reset();
+
+		uint8_t available() const;  // Number of points waiting
+		boolean read(Point& point);  // Oldest point, 'false' if none
+
+		boolean drawing() const;  // 'true' while the pen is down
+
+		void setTolerance(uint8_t counts);  // Max distance a sample can be from the simplified line
+		uint8_t getTolerance() const;
+
+		void setPressureThreshold(uint16_t pressure);  // For tablets, the pen is down above this
+		uint16_t getPressureThreshold() const;
+
+		uint32_t getSampleCount() const;  // Pen down samples in
+		uint32_t getPointCount() const;   // Points out
+		uint16_t getDropped() const;      // Points lost to a full queue
+
+		static uint8_t encode(const Point& point, uint8_t * out);  // Writes up to 'EncodedMax' bytes, returns the size
+
+		static const uint8_t Window = 8;
+		static const uint8_t QueueSize = 16;
+		static const uint8_t EncodedMax = 6;
+		static const uint16_t MaxSpan = 4095;  // Max distance per axis between kept points
+
+	protected:
+		StrokeRecorderBase(uint8_t tolerance) : tolerance(tolerance) {}
+
+		uint16_t pressureThreshold = 0;
+
+	private:
+		boolean fits(uint16_t x, uint16_t y) const;  // 'true' if the window fits the line to this sample
+		void emit(uint16_t x, uint16_t y, boolean start);
+
+		uint8_t tolerance;
+
+		boolean penDown = false;
+		uint16_t anchorX = 0, anchorY = 0;  // Last point kept
+		uint16_t lastX = 0, lastY = 0;      // Last sample
+
+		uint16_t windowX[Window];  // Samples since the anchor
+		uint16_t windowY[Window];
+		uint8_t windowSize = 0;
+
+		EventQueue<Point, QueueSize> queue;
+
+		uint32_t samples = 0;
+		uint32_t points = 0;
+	};
+}
+
+#endif
@@ -94,6 +94,75 @@ namespace NintendoExtensionCtrl {
 		}
 	}
 
+	int16_t atan2Centi(int16_t y, int16_t x) {
+		/* Integer-only atan2, using CORDIC in "vectoring" mode. Each step
+		 * rotates the (x, y) vector towards the x axis by a fixed angle of
+		 * atan(2^-i), which only takes a shift and an add, and keeps a running
+		 * total of the angles rotated. When y reaches zero the total is the
+		 * angle of the original vector.
+		 *
+		 * Vectors in the left half plane are flipped by 180 degrees first,
+		 * since the rotations only cover about +/- 99 degrees. The input is
+		 * also scaled to 13 bits: up to use as many bits as possible, otherwise
+		 * small vectors lose their precision in the shifts, or down so that
+		 * the vector (which grows by ~1.65x while rotating) fits in 16 bits.
+		 *
+		 * Against the floating point atan2, the error is within 0.08 degrees
+		 * (8 centi-degrees) across the full range of the Nunchuk's 10-bit
+		 * accelerometer values. For other inputs it's within 0.093 degrees
+		 * once scaled to 13 bits, and scaling down can add up to 0.02 more,
+		 * so anything (e.g. milli-g) is within 0.12 degrees.
+		 */
+		static const uint8_t Iterations = 12;
+		static const int16_t Angles[Iterations] = {  // atan(2^-i), centi-degrees
+			4500, 2657, 1404, 713, 358, 179, 90, 45, 22, 11, 6, 3,
+		};
+
+		if (x == 0 && y == 0) return 0;
+
+		int16_t angle = 0;
+		if (x < 0) {
+			angle = (y >= 0) ? 18000 : -18000;
+			x = -x;
+			y = -y;
+		}
+
+		uint16_t magnitude = (uint16_t) x | (uint16_t) (y < 0 ? -y : y);
+		while (magnitude >= 0x2000) {  // scale down to 13 bits
+			magnitude >>= 1;
+			x >>= 1;
+			y >>= 1;
+		}
+		while (magnitude < 0x1000) {  // scale up to 13 bits
+			magnitude <<= 1;
+			x <<= 1;
+			y <<= 1;
+		}
+
+		for (uint8_t i = 0; i < Iterations; i++) {
+			const int16_t xShift = x >> i;
+			const int16_t yShift = y >> i;
+
+			if (y > 0) {  // rotate clockwise
+				x += yShift;
+				y -= xShift;
+				angle += Angles[i];
+			}
+			else {  // rotate counter-clockwise
+				x -= yShift;
+				y += xShift;
+				angle -= Angles[i];
+			}
+		}
+
+		// Along the negative x axis the rotations can overshoot +/- 180 by a
+		// few centi-degrees, so keep the result in range
+		if (angle > 18000) angle = 18000;
+		else if (angle < -18000) angle = -18000;
+
+		return angle;
+	}
+
 	RolloverChange::RolloverChange(uint8_t min, uint8_t max) :
 		minValue(min), maxValue(max) {}
 
@@ -129,5 +198,78 @@ namespace NintendoExtensionCtrl {
 	uint8_t RolloverChange::halfRange() const {
 		return ((maxValue - minValue) / 2) + 1;
 	}
-}
 
+	ExponentialFilter::ExponentialFilter(uint8_t shift) :
+		shift(shift) {}
+
+	int16_t ExponentialFilter::update(int16_t valIn) {
+		accumulator += valIn - (accumulator >> shift);
+		return value();
+	}
+
+	int16_t ExponentialFilter::value() const {
+		return accumulator >> shift;
+	}
+
+	void ExponentialFilter::reset(int16_t valIn) {
+		accumulator = (int32_t) valIn << shift;
+	}
+
+	ButtonDebouncer::ButtonDebouncer(uint8_t samples) {
+		setSamples(samples);
+	}
+
+	uint16_t ButtonDebouncer::update(uint16_t buttonsIn) {
+		const uint16_t delta = buttonsIn ^ state;  // bits that disagree
+
+		// Count up where the input disagrees, and clear where it doesn't
+		const uint16_t carry0 = count0;
+		const uint16_t carry1 = count1 & carry0;
+		count0 = ~count0 & delta;
+		count1 = (count1 ^ carry0) & delta;
+		count2 = (count2 ^ carry1) & delta;
+
+		// Flip the bits that have reached the sample count
+		const uint16_t match = ~(
+			(count0 ^ ((samples & 1) ? 0xFFFF : 0)) |
+			(count1 ^ ((samples & 2) ? 0xFFFF : 0)) |
+			(count2 ^ ((samples & 4) ? 0xFFFF : 0)));
+
+		changed = match & delta;
+		state ^= changed;
+
+		count0 &= ~changed;
+		count1 &= ~changed;
+		count2 &= ~changed;
+
+		return state;
+	}
+
+	void ButtonDebouncer::reset(uint16_t buttonsIn) {
+		state = buttonsIn;
+		changed = 0;
+		count0 = count1 = count2 = 0;
+	}
+
+	uint16_t ButtonDebouncer::buttons() const {
+		return state;
+	}
+
+	uint16_t ButtonDebouncer::pressed() const {
+		return changed & state;
+	}
+
+	uint16_t ButtonDebouncer::released() const {
+		return changed & ~state;
+	}
+
+	void ButtonDebouncer::setSamples(uint8_t s) {
+		if (s < 1) s = 1;
+		else if (s > MaxSamples) s = MaxSamples;
+		samples = s;
+	}
+
+	uint8_t ButtonDebouncer::getSamples() const {
+		return samples;
+	}
+}
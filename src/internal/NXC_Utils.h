@@ -33,6 +33,9 @@ namespace NintendoExtensionCtrl {
 	void printRaw(uint8_t dataIn, uint8_t baseFormat = HEX, Print& output = NXC_SERIAL_DEFAULT);
 	void printRepeat(char c, uint8_t nPrint, Print& output = NXC_SERIAL_DEFAULT);
 
+	// Math
+	int16_t atan2Centi(int16_t y, int16_t x);  // -18000 to 18000 centi-degrees, any input but -32768
+
 	class RolloverChange {
 	public:
 		RolloverChange(uint8_t min, uint8_t max);
@@ -46,6 +49,176 @@ namespace NintendoExtensionCtrl {
 
 		uint8_t lastValue = 0;
 	};
+
+	// Tracks several rollover counters at once, such as the DJ effect dial.
+	// Each counter is 'Bits' wide and wraps from its max back to 0 (and the
+	// other way), and each update adds the change to a running total. The
+	// change is the shortest way around: the difference is shifted up so
+	// the counter's top bit lands in the sign bit, then back down, which
+	// wraps it without any comparisons.
+	template<uint8_t Channels, uint8_t Bits, class Total = int32_t>
+	class RolloverTracker {
+	public:
+		static_assert(Channels > 0, "Rollover tracker needs at least one channel");
+		static_assert(Bits >= 2 && Bits <= 16, "Rollover tracker supports 2-16 bit counters");
+
+		template<class T>
+		void update(const T * values) {  // one value per channel
+			if (!primed) {  // nothing to compare against yet
+				for (uint8_t i = 0; i < Channels; i++) last[i] = values[i];
+				primed = true;
+				return;
+			}
+
+			for (uint8_t i = 0; i < Channels; i++) {
+				const int16_t change = (int16_t) ((uint16_t) (values[i] - last[i]) << Shift) >> Shift;
+				last[i] = values[i];
+				changes[i] = change;
+				totals[i] += change;
+			}
+		}
+
+		int16_t getChange(uint8_t channel) const { return changes[channel]; }  // from the last update
+		Total getTotal(uint8_t channel) const { return totals[channel]; }
+
+		void reset() {
+			for (uint8_t i = 0; i < Channels; i++) {
+				changes[i] = 0;
+				totals[i] = 0;
+			}
+			primed = false;
+		}
+
+	private:
+		static const uint8_t Shift = 16 - Bits;
+
+		uint16_t last[Channels];
+		int16_t changes[Channels] = { 0 };
+		Total totals[Channels] = { 0 };
+		boolean primed = false;
+	};
+
+	class ExponentialFilter {  // Low-pass, each update moves 1/2^shift of the way to the input
+	public:
+		ExponentialFilter(uint8_t shift);
+		int16_t update(int16_t valIn);
+		int16_t value() const;
+		void reset(int16_t valIn = 0);
+	private:
+		const uint8_t shift;
+		int32_t accumulator = 0;  // Filtered value << shift
+	};
+
+	template<uint8_t Size>
+	class RunningVariance {  // Mean and variance of the last 'Size' values
+	public:
+		static_assert(Size > 0 && Size <= 16, "Running variance size must be 1-16");  // so the sums fit in 32 bits
+
+		void add(int16_t valIn) {  // Input within +/- 16383
+			const int16_t old = samples[index];
+			samples[index] = valIn;
+			index = (index + 1) % Size;
+			if (count < Size) count++;
+
+			sum += valIn - old;
+			sumSquares += (uint32_t) ((int32_t) valIn * valIn) - (uint32_t) ((int32_t) old * old);
+		}
+
+		int16_t mean() const {
+			return count ? sum / count : 0;
+		}
+
+		uint32_t variance() const {
+			if (count == 0) return 0;
+			const int16_t m = mean();
+			const uint32_t meanSquares = sumSquares / count;
+			const uint32_t squareMean = (int32_t) m * m;
+			return meanSquares > squareMean ? meanSquares - squareMean : 0;  // can round below zero
+		}
+
+		void reset() {
+			for (uint8_t i = 0; i < Size; i++) samples[i] = 0;
+			index = count = 0;
+			sum = 0;
+			sumSquares = 0;
+		}
+
+	private:
+		int16_t samples[Size] = { 0 };
+		uint8_t index = 0;
+		uint8_t count = 0;
+		int32_t sum = 0;
+		uint32_t sumSquares = 0;
+	};
+
+	template<class T, uint8_t Size>
+	class EventQueue {  // First in, first out. New events are dropped (and counted) while it's full
+	public:
+		static_assert(Size > 0, "Event queue needs at least one slot");
+
+		boolean push(const T& event) {  // 'false' if the queue is full
+			if (count == Size) {
+				if (dropped != 0xFFFF) dropped++;
+				return false;
+			}
+			queue[(head + count) % Size] = event;
+			count++;
+			return true;
+		}
+
+		boolean read(T& event) {  // Oldest event, 'false' if none
+			if (count == 0) return false;
+			event = queue[head];
+			head = (head + 1) % Size;
+			count--;
+			return true;
+		}
+
+		uint8_t available() const { return count; }
+		uint16_t getDropped() const { return dropped; }
+
+		void reset() {
+			head = count = 0;
+			dropped = 0;
+		}
+
+	private:
+		T queue[Size];
+		uint8_t head = 0;
+		uint8_t count = 0;
+		uint16_t dropped = 0;
+	};
+
+	// Debounces every bit of a packed button mask (such as 'buttons()') at
+	// once. Each bit has a 3-bit counter of how many updates in a row it has
+	// differed from its debounced state, and flips once that reaches the
+	// sample count. The counters are stored 'vertically', one word per
+	// counter bit, so every button is counted with the same few bitwise
+	// operations per update no matter how many there are.
+	class ButtonDebouncer {
+	public:
+		ButtonDebouncer(uint8_t samples = 3);
+
+		uint16_t update(uint16_t buttonsIn);  // returns the debounced buttons
+		void reset(uint16_t buttonsIn = 0);
+
+		uint16_t buttons() const;   // debounced, '1' is pressed
+		uint16_t pressed() const;   // pressed on the last update
+		uint16_t released() const;  // released on the last update
+
+		void setSamples(uint8_t samples);  // updates in a row to accept a change, 1-7
+		uint8_t getSamples() const;
+
+		static const uint8_t MaxSamples = 7;
+
+	private:
+		uint16_t state = 0;
+		uint16_t changed = 0;  // bits that flipped on the last update
+		uint16_t count0 = 0, count1 = 0, count2 = 0;  // counter bits, per button
+		uint8_t samples;
+	};
 }
 
+using ButtonDebouncer = NintendoExtensionCtrl::ButtonDebouncer;
+
 #endif